@@ -0,0 +1,221 @@
+#pragma once
+
+#include <chrono>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "Structs.h"
+#include "ThreadPool.h"
+
+//  ϳ ܰ躰 ҿ ð
+struct FAssetLoadTiming
+{
+	double QueueSeconds = 0.0;		// û  Ľ ۱ 
+	double ParseSeconds = 0.0;
+	double BuildSeconds = 0.0;
+	double OptimizeSeconds = 0.0;
+	double TotalSeconds = 0.0;		// û Ϸ
+};
+
+// δ ܰ踶 ȣϴ Լ (OBJ ļ/ Tokenizer.cpp Ƿ ٱ ־ )
+// Optimize   ȭ ܰ ǳʶ. д ܷ ˸ ڵ Wait ٽ 
+struct FMeshLoadStages
+{
+	function<void(const string&, FStaticMesh&)> Parse;
+	function<void(const FStaticMesh&, UStaticMesh&)> Build;
+	function<void(UStaticMesh&)> Optimize;
+};
+
+struct FMeshLoadState
+{
+	string Filename;
+	FStaticMesh Source;
+	UStaticMesh Mesh;
+	FAssetLoadTiming Timing;
+	chrono::steady_clock::time_point RequestTime;
+	promise<void> Done;
+	shared_future<void> DoneFuture;
+};
+
+// û ޽ ϳ  ڵ. δ  ڿ  ڵ  
+class FMeshLoadHandle
+{
+public:
+	FMeshLoadHandle() = default;
+
+	FMeshLoadHandle(shared_ptr<FMeshLoadState> InState, FThreadPool* InPool)
+		: State(move(InState))
+		, Pool(InPool)
+	{
+	}
+
+	bool IsValid() const
+	{
+		return State != nullptr;
+	}
+
+	bool IsReady() const
+	{
+		return State && State->DoneFuture.wait_for(chrono::seconds(0)) == future_status::ready;
+	}
+
+	// Ϸ   (ϴ  Ǯ  ۾  ó). ܰ迡  ܴ ⼭ ٽ 
+	UStaticMesh& Wait() const
+	{
+		Pool->Wait(State->DoneFuture);
+		return State->Mesh;
+	}
+
+	const FAssetLoadTiming& GetTiming() const
+	{
+		return State->Timing;
+	}
+
+	const string& GetFilename() const
+	{
+		return State->Filename;
+	}
+
+private:
+	shared_ptr<FMeshLoadState> State;
+	FThreadPool* Pool = nullptr;
+};
+
+// Ľ ->  -> ȭ   ۾ ̾ ϴ ޽ δ
+//  ܰ谡   ܰ踦  Ŀ  Ƿ ĳð  ä ̾,
+//  Ŀ ٸ  Ľ   ³  ٸ ھ  
+class FMeshLoader
+{
+public:
+	explicit FMeshLoader(FMeshLoadStages InStages, FThreadPool& InPool = FThreadPool::Get())
+		: Stages(move(InStages))
+		, Pool(InPool)
+	{
+	}
+
+	~FMeshLoader()
+	{
+		WaitAll();
+	}
+
+	FMeshLoader(const FMeshLoader&) = delete;
+	FMeshLoader& operator=(const FMeshLoader&) = delete;
+
+	FMeshLoadHandle Request(const string& filename)
+	{
+		shared_ptr<FMeshLoadState> State = make_shared<FMeshLoadState>();
+		State->Filename = filename;
+		State->RequestTime = chrono::steady_clock::now();
+		State->DoneFuture = State->Done.get_future().share();
+
+		{
+			lock_guard<mutex> Lock(InFlightMutex);
+			InFlight.push_back(State->DoneFuture);
+		}
+
+		Pool.Submit([this, State]() { RunStage(&FMeshLoader::RunParse, State); });
+
+		return FMeshLoadHandle(State, &Pool);
+	}
+
+	// ݱ û      (  ܴ  ʰ ڵ鿡  )
+	void WaitAll()
+	{
+		vector<shared_future<void>> Pending;
+
+		{
+			lock_guard<mutex> Lock(InFlightMutex);
+			Pending.swap(InFlight);
+		}
+
+		for (shared_future<void>& Future : Pending)
+		{
+			try
+			{
+				Pool.Wait(Future);
+			}
+			catch (...)
+			{
+			}
+		}
+	}
+
+private:
+	using Clock = chrono::steady_clock;
+
+	static double SecondsSince(Clock::time_point Start)
+	{
+		return chrono::duration<double>(Clock::now() - Start).count();
+	}
+
+	// ܰ ϳ . ܴ Done  (Submit  future ƹ  Ƿ ű  Wait  )
+	void RunStage(void (FMeshLoader::* Stage)(const shared_ptr<FMeshLoadState>&), const shared_ptr<FMeshLoadState>& State)
+	{
+		try
+		{
+			(this->*Stage)(State);
+		}
+		catch (...)
+		{
+			State->Done.set_exception(current_exception());
+		}
+	}
+
+	void RunParse(const shared_ptr<FMeshLoadState>& State)
+	{
+		auto Start = Clock::now();
+		State->Timing.QueueSeconds = chrono::duration<double>(Start - State->RequestTime).count();
+
+		Stages.Parse(State->Filename, State->Source);
+		State->Timing.ParseSeconds = SecondsSince(Start);
+
+		Pool.Submit([this, State]() { RunStage(&FMeshLoader::RunBuild, State); });
+	}
+
+	void RunBuild(const shared_ptr<FMeshLoadState>& State)
+	{
+		auto Start = Clock::now();
+
+		Stages.Build(State->Source, State->Mesh);
+		State->Timing.BuildSeconds = SecondsSince(Start);
+
+		// 尡   ʿ Ƿ ٷ 
+		State->Source = FStaticMesh();
+
+		if (Stages.Optimize)
+		{
+			Pool.Submit([this, State]() { RunStage(&FMeshLoader::RunOptimize, State); });
+		}
+		else
+		{
+			Finish(State);
+		}
+	}
+
+	void RunOptimize(const shared_ptr<FMeshLoadState>& State)
+	{
+		auto Start = Clock::now();
+
+		Stages.Optimize(State->Mesh);
+		State->Timing.OptimizeSeconds = SecondsSince(Start);
+
+		Finish(State);
+	}
+
+	void Finish(const shared_ptr<FMeshLoadState>& State)
+	{
+		State->Timing.TotalSeconds = SecondsSince(State->RequestTime);
+		State->Done.set_value();
+	}
+
+	FMeshLoadStages Stages;
+	FThreadPool& Pool;
+
+	mutex InFlightMutex;
+	vector<shared_future<void>> InFlight;
+};
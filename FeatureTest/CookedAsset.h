@@ -0,0 +1,463 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Structs.h"
+#include "MappedFile.h"
+#include "MtlParser.h"
+
+// ŷ ̳ʸ : [][ ...] ,   CookedAlignment  
+// (OBJ/MTL)  ؽð  ٸ ȿ  ٽ ŷ
+constexpr uint32_t CookedMeshMagic = 0x48534D55;		// "UMSH"
+constexpr uint32_t CookedMaterialMagic = 0x4C544D55;	// "UMTL"
+constexpr uint32_t CookedVersion = 3;
+constexpr uint64_t CookedAlignment = 64;
+
+struct alignas(64) FCookedMeshHeader
+{
+	uint32_t Magic;
+	uint32_t Version;
+	uint64_t SourceHash;
+	uint64_t SourceSize;
+	uint64_t VertexCount;
+	uint64_t VertexOffset;
+	uint64_t IndexCount;
+	uint64_t IndexOffset;
+	uint64_t SectionCount;
+	uint64_t SectionOffset;
+	uint64_t LibraryCount;
+	uint64_t LibraryOffset;
+	uint64_t StringSize;
+	uint64_t StringOffset;
+	// ε   ٽ  ʵ ٿ ڽ/  
+	float BoundsMin[3];
+	float BoundsMax[3];
+	float SphereCenter[3];
+	float SphereRadius;
+};
+
+// ڿ StringOffset  ڿ   [Offset, Length]
+struct FCookedString
+{
+	uint32_t Offset;
+	uint32_t Length;
+};
+
+//   ϳ ( ̸ ڿ ϰ ε  ٽ FName )
+struct FCookedSection
+{
+	FCookedString Material;
+	uint32_t FirstIndex;
+	uint32_t NumIndices;
+};
+
+//  ϳ  ũ ڵ
+struct FCookedMaterial
+{
+	FCookedString Name;
+	float Ns;
+	float Ka[3];
+	float Kd[3];
+	float Ks[3];
+	float Ke[3];
+	float Ni;
+	float d;
+	int32_t illum;
+	float bumpScale;
+	FCookedString map_Kd;
+	FCookedString map_Ks;
+	FCookedString map_Ke;
+	FCookedString map_Ns;
+	FCookedString map_d;
+	FCookedString map_Bump;
+};
+
+struct alignas(64) FCookedMaterialHeader
+{
+	uint32_t Magic;
+	uint32_t Version;
+	uint64_t SourceHash;
+	uint64_t SourceSize;
+	uint64_t MaterialCount;
+	uint64_t MaterialOffset;
+	uint64_t StringSize;
+	uint64_t StringOffset;
+};
+
+static_assert(sizeof(FCookedMeshHeader) == 3 * CookedAlignment, "ŷ  ũ   CookedVersion ø ");
+static_assert(sizeof(FCookedMaterialHeader) == CookedAlignment, "ŷ  ũ   CookedVersion ø ");
+static_assert(sizeof(Vertex) == 32, "Vertex ̾ƿ   CookedVersion ø ");
+
+inline uint64_t AlignCooked(uint64_t Offset)
+{
+	return (Offset + CookedAlignment - 1) & ~(CookedAlignment - 1);
+}
+
+// [Offset, Offset + Count * ElementSize)  ȿ ִ.   ġ ʵ /  
+inline bool IsCookedBlockInFile(uint64_t Offset, uint64_t Count, uint64_t ElementSize, uint64_t FileSize)
+{
+	return Offset <= FileSize && Count <= (FileSize - Offset) / ElementSize;
+}
+
+//   ؽ (8Ʈ   Ʈ  FNV ξ )
+inline uint64_t HashContent(const void* Data, size_t Size)
+{
+	const unsigned char* Bytes = static_cast<const unsigned char*>(Data);
+	uint64_t Hash = 0x9E3779B97F4A7C15ull ^ (Size * 0xFF51AFD7ED558CCDull);
+
+	auto Mix = [](uint64_t h, uint64_t k)
+	{
+		k *= 0x87C37B91114253D5ull;
+		k = (k << 31) | (k >> 33);
+		k *= 0x4CF5AD432745937Full;
+		h ^= k;
+		h = (h << 27) | (h >> 37);
+		return h * 5 + 0x52DCE729;
+	};
+
+	size_t i = 0;
+
+	for (; i + 8 <= Size; i += 8)
+	{
+		uint64_t k;
+		memcpy(&k, Bytes + i, 8);
+		Hash = Mix(Hash, k);
+	}
+
+	if (i < Size)
+	{
+		uint64_t Tail = 0;
+		memcpy(&Tail, Bytes + i, Size - i);
+		Hash = Mix(Hash, Tail);
+	}
+
+	Hash ^= Hash >> 33;
+	Hash *= 0xFF51AFD7ED558CCDull;
+	Hash ^= Hash >> 33;
+
+	return Hash;
+}
+
+inline bool HashSourceFile(const std::string& SourcePath, uint64_t& OutHash, uint64_t& OutSize)
+{
+	FMappedFile Source;
+
+	if (!Source.Open(SourcePath))
+	{
+		return false;
+	}
+
+	OutHash = HashContent(Source.Data, Source.Size);
+	OutSize = Source.Size;
+
+	return true;
+}
+
+inline void WritePadding(std::ofstream& File, uint64_t& Offset)
+{
+	static const char Zeros[CookedAlignment] = {};
+	const uint64_t Aligned = AlignCooked(Offset);
+
+	File.write(Zeros, static_cast<std::streamsize>(Aligned - Offset));
+	Offset = Aligned;
+}
+
+inline FCookedString AddCookedString(std::string& Strings, const std::string& Value)
+{
+	FCookedString Result = { static_cast<uint32_t>(Strings.size()), static_cast<uint32_t>(Value.size()) };
+	Strings += Value;
+
+	return Result;
+}
+
+inline bool SaveCookedMesh(const std::string& CookedPath, const UStaticMesh& InUStaticMesh, uint64_t SourceHash, uint64_t SourceSize)
+{
+	std::ofstream File(CookedPath, std::ios::binary | std::ios::trunc);
+
+	if (!File.is_open())
+	{
+		return false;
+	}
+
+	FCookedMeshHeader Header = {};
+	Header.Magic = CookedMeshMagic;
+	Header.Version = CookedVersion;
+	Header.SourceHash = SourceHash;
+	Header.SourceSize = SourceSize;
+	Header.VertexCount = InUStaticMesh.Vertices.size();
+	Header.VertexOffset = AlignCooked(sizeof(Header));
+	Header.IndexCount = InUStaticMesh.Indices.size();
+	Header.IndexOffset = AlignCooked(Header.VertexOffset + Header.VertexCount * sizeof(Vertex));
+
+	std::vector<FCookedSection> Sections;
+	std::vector<FCookedString> Libraries;
+	std::string Strings;
+
+	for (const FStaticMeshSection& Section : InUStaticMesh.Sections)
+	{
+		Sections.push_back({ AddCookedString(Strings, Section.Material.ToString()), Section.FirstIndex, Section.NumIndices });
+	}
+
+	for (const std::string& Library : InUStaticMesh.MaterialLibraries)
+	{
+		Libraries.push_back(AddCookedString(Strings, Library));
+	}
+
+	Header.SectionCount = Sections.size();
+	Header.SectionOffset = AlignCooked(Header.IndexOffset + Header.IndexCount * sizeof(int));
+	Header.LibraryCount = Libraries.size();
+	Header.LibraryOffset = AlignCooked(Header.SectionOffset + Header.SectionCount * sizeof(FCookedSection));
+	Header.StringSize = Strings.size();
+	Header.StringOffset = AlignCooked(Header.LibraryOffset + Header.LibraryCount * sizeof(FCookedString));
+
+	const FBox& Bounds = InUStaticMesh.Bounds;
+	const FSphere& Sphere = InUStaticMesh.BoundingSphere;
+
+	Header.BoundsMin[0] = Bounds.Min.x; Header.BoundsMin[1] = Bounds.Min.y; Header.BoundsMin[2] = Bounds.Min.z;
+	Header.BoundsMax[0] = Bounds.Max.x; Header.BoundsMax[1] = Bounds.Max.y; Header.BoundsMax[2] = Bounds.Max.z;
+	Header.SphereCenter[0] = Sphere.Center.x; Header.SphereCenter[1] = Sphere.Center.y; Header.SphereCenter[2] = Sphere.Center.z;
+	Header.SphereRadius = Sphere.Radius;
+
+	uint64_t Offset = sizeof(Header);
+	File.write(reinterpret_cast<const char*>(&Header), sizeof(Header));
+
+	WritePadding(File, Offset);
+	File.write(reinterpret_cast<const char*>(InUStaticMesh.Vertices.data()), Header.VertexCount * sizeof(Vertex));
+	Offset += Header.VertexCount * sizeof(Vertex);
+
+	WritePadding(File, Offset);
+	File.write(reinterpret_cast<const char*>(InUStaticMesh.Indices.data()), Header.IndexCount * sizeof(int));
+	Offset += Header.IndexCount * sizeof(int);
+
+	WritePadding(File, Offset);
+	File.write(reinterpret_cast<const char*>(Sections.data()), Sections.size() * sizeof(FCookedSection));
+	Offset += Sections.size() * sizeof(FCookedSection);
+
+	WritePadding(File, Offset);
+	File.write(reinterpret_cast<const char*>(Libraries.data()), Libraries.size() * sizeof(FCookedString));
+	Offset += Libraries.size() * sizeof(FCookedString);
+
+	WritePadding(File, Offset);
+	File.write(Strings.data(), Strings.size());
+
+	return File.good();
+}
+
+// ŷ ޽ø  ä ٷ  (/ε  ޸𸮸 ״ Ŵ)
+struct FCookedMesh
+{
+	FMappedFile File;
+	const Vertex* Vertices = nullptr;
+	const int* Indices = nullptr;
+	const FCookedSection* Sections = nullptr;
+	const FCookedString* Libraries = nullptr;
+	const char* Strings = nullptr;
+	size_t NumVertices = 0;
+	size_t NumIndices = 0;
+	size_t NumSections = 0;
+	size_t NumLibraries = 0;
+	size_t StringSize = 0;
+	FBox Bounds;
+	FSphere BoundingSphere;
+
+	// /ũ/ ؽð    
+	bool Open(const std::string& CookedPath, uint64_t SourceHash, uint64_t SourceSize)
+	{
+		if (!File.Open(CookedPath) || File.Size < sizeof(FCookedMeshHeader))
+		{
+			File.Close();
+			return false;
+		}
+
+		const FCookedMeshHeader* Header = reinterpret_cast<const FCookedMeshHeader*>(File.Data);
+
+		const bool bValid = Header->Magic == CookedMeshMagic
+			&& Header->Version == CookedVersion
+			&& Header->SourceHash == SourceHash
+			&& Header->SourceSize == SourceSize
+			&& IsCookedBlockInFile(Header->VertexOffset, Header->VertexCount, sizeof(Vertex), File.Size)
+			&& IsCookedBlockInFile(Header->IndexOffset, Header->IndexCount, sizeof(int), File.Size)
+			&& IsCookedBlockInFile(Header->SectionOffset, Header->SectionCount, sizeof(FCookedSection), File.Size)
+			&& IsCookedBlockInFile(Header->LibraryOffset, Header->LibraryCount, sizeof(FCookedString), File.Size)
+			&& IsCookedBlockInFile(Header->StringOffset, Header->StringSize, 1, File.Size);
+
+		if (!bValid)
+		{
+			File.Close();
+			return false;
+		}
+
+		Vertices = reinterpret_cast<const Vertex*>(File.Data + Header->VertexOffset);
+		Indices = reinterpret_cast<const int*>(File.Data + Header->IndexOffset);
+		NumVertices = static_cast<size_t>(Header->VertexCount);
+		NumIndices = static_cast<size_t>(Header->IndexCount);
+		Sections = reinterpret_cast<const FCookedSection*>(File.Data + Header->SectionOffset);
+		Libraries = reinterpret_cast<const FCookedString*>(File.Data + Header->LibraryOffset);
+		Strings = File.Data + Header->StringOffset;
+		NumSections = static_cast<size_t>(Header->SectionCount);
+		NumLibraries = static_cast<size_t>(Header->LibraryCount);
+		StringSize = static_cast<size_t>(Header->StringSize);
+
+		Bounds.Min = FVector(Header->BoundsMin[0], Header->BoundsMin[1], Header->BoundsMin[2]);
+		Bounds.Max = FVector(Header->BoundsMax[0], Header->BoundsMax[1], Header->BoundsMax[2]);
+		BoundingSphere.Center = FVector(Header->SphereCenter[0], Header->SphereCenter[1], Header->SphereCenter[2]);
+		BoundingSphere.Radius = Header->SphereRadius;
+
+		return true;
+	}
+
+	std::string_view GetString(const FCookedString& s) const
+	{
+		return (static_cast<uint64_t>(s.Offset) + s.Length <= StringSize) ? std::string_view(Strings + s.Offset, s.Length) : std::string_view();
+	}
+
+	// UStaticMesh ʿ     ( ȯ ۾ )
+	void CopyTo(UStaticMesh& OutUStaticMesh) const
+	{
+		OutUStaticMesh.Vertices.assign(Vertices, Vertices + NumVertices);
+		OutUStaticMesh.Indices.assign(Indices, Indices + NumIndices);
+		OutUStaticMesh.Sections.clear();
+		OutUStaticMesh.MaterialLibraries.clear();
+		OutUStaticMesh.Tangents.clear();
+		OutUStaticMesh.Bounds = Bounds;
+		OutUStaticMesh.BoundingSphere = BoundingSphere;
+
+		for (size_t i = 0; i < NumSections; i++)
+		{
+			OutUStaticMesh.Sections.push_back({ FName(GetString(Sections[i].Material)), Sections[i].FirstIndex, Sections[i].NumIndices });
+		}
+
+		for (size_t i = 0; i < NumLibraries; i++)
+		{
+			OutUStaticMesh.MaterialLibraries.emplace_back(GetString(Libraries[i]));
+		}
+	}
+};
+
+inline bool SaveCookedMaterials(const std::string& CookedPath, const std::vector<MtlMaterial>& InMaterials, uint64_t SourceHash, uint64_t SourceSize)
+{
+	std::ofstream File(CookedPath, std::ios::binary | std::ios::trunc);
+
+	if (!File.is_open())
+	{
+		return false;
+	}
+
+	std::vector<FCookedMaterial> Records;
+	std::string Strings;
+
+	Records.reserve(InMaterials.size());
+
+	for (const MtlMaterial& m : InMaterials)
+	{
+		FCookedMaterial r = {};
+
+		r.Name = AddCookedString(Strings, m.Name);
+		r.Ns = m.Ns;
+		r.Ka[0] = m.Ka.x; r.Ka[1] = m.Ka.y; r.Ka[2] = m.Ka.z;
+		r.Kd[0] = m.Kd.x; r.Kd[1] = m.Kd.y; r.Kd[2] = m.Kd.z;
+		r.Ks[0] = m.Ks.x; r.Ks[1] = m.Ks.y; r.Ks[2] = m.Ks.z;
+		r.Ke[0] = m.Ke.x; r.Ke[1] = m.Ke.y; r.Ke[2] = m.Ke.z;
+		r.Ni = m.Ni;
+		r.d = m.d;
+		r.illum = m.illum;
+		r.bumpScale = m.bumpScale;
+		r.map_Kd = AddCookedString(Strings, m.map_Kd);
+		r.map_Ks = AddCookedString(Strings, m.map_Ks);
+		r.map_Ke = AddCookedString(Strings, m.map_Ke);
+		r.map_Ns = AddCookedString(Strings, m.map_Ns);
+		r.map_d = AddCookedString(Strings, m.map_d);
+		r.map_Bump = AddCookedString(Strings, m.map_Bump);
+
+		Records.push_back(r);
+	}
+
+	FCookedMaterialHeader Header = {};
+	Header.Magic = CookedMaterialMagic;
+	Header.Version = CookedVersion;
+	Header.SourceHash = SourceHash;
+	Header.SourceSize = SourceSize;
+	Header.MaterialCount = Records.size();
+	Header.MaterialOffset = AlignCooked(sizeof(Header));
+	Header.StringSize = Strings.size();
+	Header.StringOffset = AlignCooked(Header.MaterialOffset + Records.size() * sizeof(FCookedMaterial));
+
+	uint64_t Offset = sizeof(Header);
+	File.write(reinterpret_cast<const char*>(&Header), sizeof(Header));
+
+	WritePadding(File, Offset);
+	File.write(reinterpret_cast<const char*>(Records.data()), Records.size() * sizeof(FCookedMaterial));
+	Offset += Records.size() * sizeof(FCookedMaterial);
+
+	WritePadding(File, Offset);
+	File.write(Strings.data(), Strings.size());
+
+	return File.good();
+}
+
+inline bool LoadCookedMaterials(const std::string& CookedPath, uint64_t SourceHash, uint64_t SourceSize, std::vector<MtlMaterial>& OutMaterials)
+{
+	FMappedFile File;
+
+	if (!File.Open(CookedPath) || File.Size < sizeof(FCookedMaterialHeader))
+	{
+		return false;
+	}
+
+	const FCookedMaterialHeader* Header = reinterpret_cast<const FCookedMaterialHeader*>(File.Data);
+
+	const bool bValid = Header->Magic == CookedMaterialMagic
+		&& Header->Version == CookedVersion
+		&& Header->SourceHash == SourceHash
+		&& Header->SourceSize == SourceSize
+		&& IsCookedBlockInFile(Header->MaterialOffset, Header->MaterialCount, sizeof(FCookedMaterial), File.Size)
+		&& IsCookedBlockInFile(Header->StringOffset, Header->StringSize, 1, File.Size);
+
+	if (!bValid)
+	{
+		return false;
+	}
+
+	const FCookedMaterial* Records = reinterpret_cast<const FCookedMaterial*>(File.Data + Header->MaterialOffset);
+	const char* Strings = File.Data + Header->StringOffset;
+
+	auto ToString = [&](const FCookedString& s)
+	{
+		return (static_cast<uint64_t>(s.Offset) + s.Length <= Header->StringSize) ? std::string(Strings + s.Offset, s.Length) : std::string();
+	};
+
+	OutMaterials.clear();
+	OutMaterials.reserve(static_cast<size_t>(Header->MaterialCount));
+
+	for (size_t i = 0; i < Header->MaterialCount; i++)
+	{
+		const FCookedMaterial& r = Records[i];
+		MtlMaterial m;
+
+		m.Name = ToString(r.Name);
+		m.Ns = r.Ns;
+		m.Ka = FVector(r.Ka[0], r.Ka[1], r.Ka[2]);
+		m.Kd = FVector(r.Kd[0], r.Kd[1], r.Kd[2]);
+		m.Ks = FVector(r.Ks[0], r.Ks[1], r.Ks[2]);
+		m.Ke = FVector(r.Ke[0], r.Ke[1], r.Ke[2]);
+		m.Ni = r.Ni;
+		m.d = r.d;
+		m.illum = r.illum;
+		m.bumpScale = r.bumpScale;
+		m.map_Kd = ToString(r.map_Kd);
+		m.map_Ks = ToString(r.map_Ks);
+		m.map_Ke = ToString(r.map_Ke);
+		m.map_Ns = ToString(r.map_Ns);
+		m.map_d = ToString(r.map_d);
+		m.map_Bump = ToString(r.map_Bump);
+
+		OutMaterials.push_back(std::move(m));
+	}
+
+	return true;
+}
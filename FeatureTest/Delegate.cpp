@@ -1,23 +1,174 @@
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <functional>
-#include <unordered_map>
-#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
-using FDelegateHandle = size_t;
+//  Ҵ Ƚ (Broadcast Ҵ ʴ Ȯο).  忡 ҴϹǷ atomic
+static std::atomic<size_t> AllocationCount{ 0 };
 
+// ü new/delete ȣ  ζεǸ GCC malloc delete ¦ -Wmismatched-new-delete  Ƿ ζ 
+#if defined(_MSC_VER)
+#define DELEGATE_NOINLINE __declspec(noinline)
+#else
+#define DELEGATE_NOINLINE __attribute__((noinline))
+#endif
+
+DELEGATE_NOINLINE void* operator new(size_t size) {
+    AllocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+DELEGATE_NOINLINE void operator delete(void* p) noexcept { std::free(p); }
+DELEGATE_NOINLINE void operator delete(void* p, size_t) noexcept { std::free(p); }
+
+//  32Ʈ =  ȣ,  32Ʈ =   ( ٽ  밡 ٲ  ڵ ȿ). 0 ȿ ڵ
+using FDelegateHandle = uint64_t;
+
+// ȣ  ϳ. ü +  Լ ͳ    ĸó ó ۰ 簡 ܼ(trivially copyable) 
+//  Ҵ  ȿ ϰ,   ͸  ϳ  ͸ 
+//  ̵   Ʈ ״ Űܵ ǹǷ  迭 Ŀ  memcpy ̵
+template<typename... Args>
+class TDelegateCallable
+{
+public:
+    // MSVC    Լ (ִ 24Ʈ) + ü ͱ  ũ
+    static constexpr size_t InlineSize = 4 * sizeof(void*);
+
+    template<typename F>
+    static constexpr bool IsInline = sizeof(F) <= InlineSize && alignof(F) <= alignof(void*) && std::is_trivially_copyable_v<F>;
+
+    TDelegateCallable() = default;
+
+    TDelegateCallable(TDelegateCallable&& Other) noexcept
+    {
+        MoveFrom(Other);
+    }
+
+    TDelegateCallable& operator=(TDelegateCallable&& Other) noexcept
+    {
+        if (this != &Other)
+        {
+            Reset();
+            MoveFrom(Other);
+        }
+        return *this;
+    }
+
+    TDelegateCallable(const TDelegateCallable&) = delete;
+    TDelegateCallable& operator=(const TDelegateCallable&) = delete;
+
+    ~TDelegateCallable()
+    {
+        Reset();
+    }
+
+    template<typename F>
+    void Bind(F&& Func)
+    {
+        using FuncType = std::decay_t<F>;
+
+        Reset();
+
+        if constexpr (IsInline<FuncType>)
+        {
+            new (Storage) FuncType(std::forward<F>(Func));
+            InvokeFn = [](void* Target, Args... args) { (*static_cast<FuncType*>(Target))(args...); };
+        }
+        else
+        {
+            FuncType* Heap = new FuncType(std::forward<F>(Func));
+            std::memcpy(Storage, &Heap, sizeof(Heap));
+            InvokeFn = [](void* Target, Args... args) { (**static_cast<FuncType**>(Target))(args...); };
+            DestroyFn = [](void* Target) { delete *static_cast<FuncType**>(Target); };
+        }
+    }
+
+    void Reset()
+    {
+        if (DestroyFn)
+        {
+            DestroyFn(Storage);
+        }
+
+        InvokeFn = nullptr;
+        DestroyFn = nullptr;
+    }
+
+    bool IsBound() const
+    {
+        return InvokeFn != nullptr;
+    }
+
+    void operator()(Args... args)
+    {
+        InvokeFn(Storage, args...);
+    }
+
+private:
+    void MoveFrom(TDelegateCallable& Other)
+    {
+        std::memcpy(Storage, Other.Storage, InlineSize);
+        InvokeFn = Other.InvokeFn;
+        DestroyFn = Other.DestroyFn;
+        Other.InvokeFn = nullptr;
+        Other.DestroyFn = nullptr;
+    }
+
+    alignas(void*) unsigned char Storage[InlineSize];
+    void (*InvokeFn)(void*, Args...) = nullptr;
+    void (*DestroyFn)(void*) = nullptr;    //   츸
+};
+
+// ü +  Լ  (ٷ  ʰ ״ )
+template<typename T, typename FuncType>
+struct TMemberBinding
+{
+    T* Instance;
+    FuncType Func;
+
+    template<typename... CallArgs>
+    void operator()(CallArgs&&... args) const
+    {
+        (Instance->*Func)(std::forward<CallArgs>(args)...);
+    }
+};
+
+// ƼĳƮ Ʈ. ڵ鷯  ȣ   迭 ƴ   (  )
+// Broadcast     ȣϰ,   Remove/Clear ǥø  ξٰ  ٱ Broadcast   
+//  ߿ Add ڵ鷯  Broadcast ȣ 
 template<typename... Args>
 class TDelegate
 {
 public:
     using HandlerType = std::function<void(Args...)>;
 
-    TDelegate() : NextHandle(1) {}
+    TDelegate() = default;
+    TDelegate(const TDelegate&) = delete;
+    TDelegate& operator=(const TDelegate&) = delete;
 
-    // Ϲ Լ  
-    FDelegateHandle Add(const HandlerType& handler)
+    // Ϲ Լ   ( ٴ  Ҵ ).  std::function̳ nullptr Լ ͸ 0
+    template<typename F>
+    FDelegateHandle Add(F&& handler)
     {
-        FDelegateHandle handle = NextHandle++;
-        Handlers[handle] = handler;
-        return handle;
+        if constexpr (std::is_constructible_v<bool, const std::decay_t<F>&>)
+        {
+            if (!static_cast<bool>(handler))
+            {
+                return 0;
+            }
+        }
+
+        return AddSlot(std::forward<F>(handler));
     }
 
     // Ŭ  Լ ε
@@ -29,13 +180,7 @@ public:
             return 0; // Invalid handle
         }
 
-        auto handler = [Instance, Func](Args... args) {
-            (Instance->*Func)(args...);
-            };
-
-        FDelegateHandle handle = NextHandle++;
-        Handlers[handle] = handler;
-        return handle;
+        return AddSlot(TMemberBinding<T, void (T::*)(Args...)>{ Instance, Func });
     }
 
     // Const  Լ 
@@ -47,37 +192,46 @@ public:
             return 0;
         }
 
-        auto handler = [Instance, Func](Args... args) {
-            (Instance->*Func)(args...);
-            };
-
-        FDelegateHandle handle = NextHandle++;
-        Handlers[handle] = handler;
-        return handle;
+        return AddSlot(TMemberBinding<const T, void (T::*)(Args...) const>{ Instance, Func });
     }
 
     // ڵ Ư ڵ鷯 
     bool Remove(FDelegateHandle handle)
     {
-        auto it = Handlers.find(handle);
-        if (it != Handlers.end())
+        const uint32_t index = static_cast<uint32_t>(handle);
+        const uint32_t generation = static_cast<uint32_t>(handle >> 32);
+
+        if (index >= NumSlots())
         {
-            Handlers.erase(it);
-            return true;
+            return false;
         }
-        return false;
+
+        FSlot& slot = GetSlot(index);
+
+        if (slot.Generation != generation || !slot.bActive)
+        {
+            return false;
+        }
+
+        RemoveSlot(index);
+        return true;
     }
 
     //  ڵ鷯 ȣ
     void Broadcast(Args... args)
     {
-        //  纻 ȸ (   )
-        auto handlersCopy = Handlers;
-        for (const auto& pair : handlersCopy)
+        FBroadcastScope scope(*this);
+
+        //   Ա ( ߿ ߰  PendingSlots )
+        const size_t count = Slots.size();
+
+        for (size_t i = 0; i < count; i++)
         {
-            if (pair.second)
+            FSlot& slot = Slots[i];
+
+            if (slot.bActive)
             {
-                pair.second(args...);
+                slot.Callable(args...);
             }
         }
     }
@@ -85,24 +239,479 @@ public:
     //  ڵ鷯 
     void Clear()
     {
-        Handlers.clear();
+        for (uint32_t index = 0; index < NumSlots(); index++)
+        {
+            if (GetSlot(index).bActive)
+            {
+                RemoveSlot(index);
+            }
+        }
     }
 
     // ε  Ȯ
     bool IsBound() const
     {
-        return !Handlers.empty();
+        return NumBound > 0;
     }
 
     // ڵ鷯 
     size_t Num() const
     {
-        return Handlers.size();
+        return NumBound;
+    }
+
+private:
+    struct FSlot
+    {
+        TDelegateCallable<Args...> Callable;
+        uint32_t Generation = 1;
+        bool bActive = false;    //  ǥõ  ȣ  (Callable Broadcast   )
+    };
+
+    // ܷ  ̸ ǵ ̷   
+    struct FBroadcastScope
+    {
+        TDelegate& Delegate;
+
+        explicit FBroadcastScope(TDelegate& InDelegate) : Delegate(InDelegate)
+        {
+            Delegate.BroadcastDepth++;
+        }
+
+        ~FBroadcastScope()
+        {
+            if (--Delegate.BroadcastDepth == 0)
+            {
+                Delegate.FlushDeferred();
+            }
+        }
+    };
+
+    uint32_t NumSlots() const
+    {
+        return static_cast<uint32_t>(Slots.size() + PendingSlots.size());
+    }
+
+    FSlot& GetSlot(uint32_t index)
+    {
+        return index < Slots.size() ? Slots[index] : PendingSlots[index - Slots.size()];
+    }
+
+    template<typename F>
+    FDelegateHandle AddSlot(F&& handler)
+    {
+        uint32_t index = 0;
+
+        // Broadcast ߿ Slots ҴǸ   ڵ鷯 ŰǷ ڿ   
+        if (BroadcastDepth > 0)
+        {
+            index = NumSlots();
+            PendingSlots.emplace_back();
+        }
+        else if (!FreeSlots.empty())
+        {
+            index = FreeSlots.back();
+            FreeSlots.pop_back();
+        }
+        else
+        {
+            index = NumSlots();
+            Slots.emplace_back();
+        }
+
+        FSlot& slot = GetSlot(index);
+        slot.Callable.Bind(std::forward<F>(handler));
+        slot.bActive = true;
+        NumBound++;
+
+        return (static_cast<FDelegateHandle>(slot.Generation) << 32) | index;
+    }
+
+    void RemoveSlot(uint32_t index)
+    {
+        FSlot& slot = GetSlot(index);
+
+        slot.bActive = false;
+        NumBound--;
+
+        if (BroadcastDepth > 0)
+        {
+            DeferredFrees.push_back(index);
+        }
+        else
+        {
+            ReleaseSlot(index);
+        }
+    }
+
+    // 븦 ÷  ڵ ٽ  ʰ ϰ   
+    void ReleaseSlot(uint32_t index)
+    {
+        FSlot& slot = GetSlot(index);
+
+        slot.Callable.Reset();
+        slot.Generation = slot.Generation == UINT32_MAX ? 1 : slot.Generation + 1;
+        FreeSlots.push_back(index);
+    }
+
+    void FlushDeferred()
+    {
+        for (FSlot& slot : PendingSlots)
+        {
+            Slots.push_back(std::move(slot));
+        }
+
+        PendingSlots.clear();
+
+        for (uint32_t index : DeferredFrees)
+        {
+            ReleaseSlot(index);
+        }
+
+        DeferredFrees.clear();
+    }
+
+    std::vector<FSlot> Slots;
+    std::vector<FSlot> PendingSlots;       // Broadcast ߿ ߰  (ȣ Slots ڿ ̾)
+    std::vector<uint32_t> FreeSlots;
+    std::vector<uint32_t> DeferredFrees;   // Broadcast ߿ ŵ 
+    size_t NumBound = 0;
+    int BroadcastDepth = 0;
+};
+
+//  忡 /ȣϴ ƼĳƮ Ʈ (RCU)
+// Broadcast    ڵ鷯 (Һ  迭) а, Add/Remove  ؽ ȿ    ü
+// ü  ŵ ڵ鷯    Broadcast   ( Ⱓ) 
+//  - б īʹ 庰  (stripe)  Ȧ¦  . Broadcast ڱ    ī͸ ÷ȴ 
+//  -  Ⱓ: 븦 ѱ   īͰ 0   ⸦   (븦   и б Եǵ)
+// Remove ƿ ڿ  ڵ鷯 ȣ , ٽ ȣ 
+// ( Ʈ Broadcast ȿ θ Remove ٸ ʰ  ̷. ٸ Ʈ ڵ鷯 ȿ θ ٸ)
+template<typename... Args>
+class TConcurrentDelegate
+{
+public:
+    TConcurrentDelegate() = default;
+    TConcurrentDelegate(const TConcurrentDelegate&) = delete;
+    TConcurrentDelegate& operator=(const TConcurrentDelegate&) = delete;
+
+    // Ҹ  Broadcast  尡  
+    ~TConcurrentDelegate()
+    {
+        FSnapshot* snapshot = Current.load();
+
+        if (snapshot)
+        {
+            for (FHandlerNode* node : snapshot->Nodes)
+            {
+                delete node;
+            }
+
+            delete snapshot;
+        }
+
+        FreeRetired(Retired);
+    }
+
+    template<typename F>
+    FDelegateHandle Add(F&& handler)
+    {
+        if constexpr (std::is_constructible_v<bool, const std::decay_t<F>&>)
+        {
+            if (!static_cast<bool>(handler))
+            {
+                return 0;
+            }
+        }
+
+        FHandlerNode* node = new FHandlerNode();
+        node->Callable.Bind(std::forward<F>(handler));
+
+        std::vector<FRetired> retired;
+        FDelegateHandle handle = 0;
+
+        {
+            std::lock_guard<std::mutex> lock(WriteMutex);
+
+            handle = node->Handle = NextHandle++;
+
+            FSnapshot* snapshot = Current.load();
+            FSnapshot* next = new FSnapshot();
+
+            if (snapshot)
+            {
+                next->Nodes.reserve(snapshot->Nodes.size() + 1);
+                next->Nodes = snapshot->Nodes;
+            }
+
+            next->Nodes.push_back(node);
+            Publish(next, nullptr);
+
+            //   ׾ ξٰ    Ѳ 
+            TakeRetired(Retired.size() >= 64, retired);
+        }
+
+        Reclaim(retired);
+        return handle;
+    }
+
+    template<typename T>
+    FDelegateHandle AddDynamic(T* Instance, void (T::* Func)(Args...))
+    {
+        return Instance ? Add(TMemberBinding<T, void (T::*)(Args...)>{ Instance, Func }) : 0;
+    }
+
+    template<typename T>
+    FDelegateHandle AddDynamic(T* Instance, void (T::* Func)(Args...) const)
+    {
+        return Instance ? Add(TMemberBinding<const T, void (T::*)(Args...) const>{ Instance, Func }) : 0;
+    }
+
+    //   Broadcast   ٸ  ڵ鷯  (ĸó ¸ ٷ  )
+    bool Remove(FDelegateHandle handle)
+    {
+        std::vector<FRetired> retired;
+
+        {
+            std::lock_guard<std::mutex> lock(WriteMutex);
+
+            FSnapshot* snapshot = Current.load();
+            FHandlerNode* removed = nullptr;
+
+            if (snapshot)
+            {
+                for (FHandlerNode* node : snapshot->Nodes)
+                {
+                    if (node->Handle == handle)
+                    {
+                        removed = node;
+                        break;
+                    }
+                }
+            }
+
+            if (removed == nullptr)
+            {
+                return false;
+            }
+
+            FSnapshot* next = new FSnapshot();
+            next->Nodes.reserve(snapshot->Nodes.size() - 1);
+
+            for (FHandlerNode* node : snapshot->Nodes)
+            {
+                if (node != removed)
+                {
+                    next->Nodes.push_back(node);
+                }
+            }
+
+            Publish(next, removed);
+            TakeRetired(true, retired);
+        }
+
+        Reclaim(retired);
+        return true;
+    }
+
+    void Clear()
+    {
+        std::vector<FRetired> retired;
+
+        {
+            std::lock_guard<std::mutex> lock(WriteMutex);
+
+            FSnapshot* snapshot = Current.exchange(nullptr);
+
+            if (snapshot == nullptr)
+            {
+                return;
+            }
+
+            for (FHandlerNode* node : snapshot->Nodes)
+            {
+                Retired.push_back({ nullptr, node });
+            }
+
+            Retired.push_back({ snapshot, nullptr });
+            TakeRetired(true, retired);
+        }
+
+        Reclaim(retired);
+    }
+
+    // /Ҵ . ٸ  Add/Remove ÿ ҷ 
+    void Broadcast(Args... args)
+    {
+        FReadScope scope(*this);
+
+        if (const FSnapshot* snapshot = Current.load())
+        {
+            for (FHandlerNode* node : snapshot->Nodes)
+            {
+                node->Callable(args...);
+            }
+        }
+    }
+
+    bool IsBound() const
+    {
+        return Num() > 0;
+    }
+
+    // ٸ 尡 ٲٴ ̸  /  ϳ
+    size_t Num() const
+    {
+        FReadScope scope(*this);
+        const FSnapshot* snapshot = Current.load();
+
+        return snapshot ? snapshot->Nodes.size() : 0;
     }
 
 private:
-    std::unordered_map<FDelegateHandle, HandlerType> Handlers;
-    FDelegateHandle NextHandle;
+    struct FHandlerNode
+    {
+        FDelegateHandle Handle = 0;
+        TDelegateCallable<Args...> Callable;
+    };
+
+    struct FSnapshot
+    {
+        std::vector<FHandlerNode*> Nodes;
+    };
+
+    //  Ⱓ    ( Ǵ ڵ鷯 ϳ)
+    struct FRetired
+    {
+        FSnapshot* Snapshot;
+        FHandlerNode* Node;
+    };
+
+    static constexpr int NumStripes = 16;
+
+    // ٸ ĳ  ϳ (Broadcast 峢  ī͸ ΰ  ʵ)
+    struct alignas(64) FReaderStripe
+    {
+        std::atomic<uint32_t> Count[2] = {};
+    };
+
+    struct FReadScope;
+
+    //  忡   Broadcast    (ٱ Outer ̾)
+    //  ñ״ó Ʈ ϹǷ ڱ ڽ  ִ νϽ Ȯ
+    static inline thread_local const FReadScope* InnermostRead = nullptr;
+
+    static uint32_t ThreadStripe()
+    {
+        static std::atomic<uint32_t> NextStripe{ 0 };
+        thread_local const uint32_t stripe = NextStripe.fetch_add(1, std::memory_order_relaxed) % NumStripes;
+
+        return stripe;
+    }
+
+    struct FReadScope
+    {
+        const TConcurrentDelegate& Delegate;
+        std::atomic<uint32_t>& Counter;
+        const FReadScope* Outer;
+
+        explicit FReadScope(const TConcurrentDelegate& InDelegate)
+            : Delegate(InDelegate)
+            , Counter(InDelegate.Readers[ThreadStripe()].Count[InDelegate.Epoch.load() & 1])
+            , Outer(InnermostRead)
+        {
+            Counter.fetch_add(1);
+            InnermostRead = this;
+        }
+
+        ~FReadScope()
+        {
+            InnermostRead = Outer;
+            Counter.fetch_sub(1, std::memory_order_release);
+        }
+    };
+
+    //  尡  Ʈ Broadcast (ڵ鷯) ִ. ׷ٸ ٸ ڱ ڽ ٸ 
+    bool IsBroadcastingOnThisThread() const
+    {
+        for (const FReadScope* scope = InnermostRead; scope; scope = scope->Outer)
+        {
+            if (&scope->Delegate == this)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    //   Խ ( ؽ ).   ŵ ڵ鷯  Ⱓ  ϵ Retired
+    void Publish(FSnapshot* next, FHandlerNode* removed)
+    {
+        Retired.push_back({ Current.exchange(next), removed });
+    }
+
+    //  ؽ ȿ   .  Ʈ Broadcast ȿ ҷ  ̷
+    void TakeRetired(bool bWanted, std::vector<FRetired>& outRetired)
+    {
+        if (bWanted && !IsBroadcastingOnThisThread())
+        {
+            outRetired.swap(Retired);
+        }
+    }
+
+    //  ؽ ۿ ٸ   (ؽ  ä ٸ ڵ鷯 ȿ Add/Removeϴ Broadcast  ٸ)
+    void Reclaim(std::vector<FRetired>& retired)
+    {
+        if (retired.empty())
+        {
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(SyncMutex);
+            WaitForReaders();
+        }
+
+        FreeRetired(retired);
+    }
+
+    //  ȣ   Broadcast     ( ѱ SyncMutex   ϳ)
+    void WaitForReaders()
+    {
+        for (int pass = 0; pass < 2; pass++)
+        {
+            const uint32_t previous = Epoch.load() & 1;
+            Epoch.store(previous ^ 1);
+
+            for (FReaderStripe& stripe : Readers)
+            {
+                while (stripe.Count[previous].load() != 0)
+                {
+                    std::this_thread::yield();
+                }
+            }
+        }
+    }
+
+    static void FreeRetired(std::vector<FRetired>& retired)
+    {
+        for (const FRetired& entry : retired)
+        {
+            delete entry.Snapshot;
+            delete entry.Node;
+        }
+
+        retired.clear();
+    }
+
+    std::atomic<FSnapshot*> Current{ nullptr };
+    std::atomic<uint32_t> Epoch{ 0 };
+    mutable FReaderStripe Readers[NumStripes];
+
+    std::mutex WriteMutex;      //  ü
+    std::mutex SyncMutex;       //  Ⱓ 
+    std::vector<FRetired> Retired;
+    FDelegateHandle NextHandle = 1;
 };
 
 #define DECLARE_DELEGATE(Name, ...) using Name = TDelegate<__VA_ARGS__>
@@ -241,6 +850,286 @@ private:
     AActor* TargetActor = nullptr;
 };
 
+// ==========   ⸸ ϴ  (ð ) ==========
+class UDamageCounter
+{
+public:
+    void Bind(AActor* Actor)
+    {
+        Actor->OnTakeDamage.AddDynamic(this, &UDamageCounter::OnTakeDamage);
+        Actor->OnHealthChanged.AddDynamic(this, &UDamageCounter::OnHealthChanged);
+        Actor->OnDeath.Add([this]() { Deaths++; });
+    }
+
+    void OnTakeDamage(float Damage, AActor*) { TotalDamage += Damage; }
+    void OnHealthChanged(float, float NewHealth) const { LastHealth = NewHealth; }
+
+    float TotalDamage = 0.0f;
+    mutable float LastHealth = 0.0f;
+    int Deaths = 0;
+};
+
+// Broadcast  /߰,    ڵ
+bool TestDeferredRemoval()
+{
+    TDelegate<int> Delegate;
+    std::vector<int> Calls;
+    FDelegateHandle Second = 0;
+    FDelegateHandle Self = 0;
+    FDelegateHandle Added = 0;
+
+    // ù ° ڵ鷯 ڽŰ  ° ϰ  ڵ鷯 ߰
+    Self = Delegate.Add([&](int) {
+        Calls.push_back(1);
+        Delegate.Remove(Self);
+        Delegate.Remove(Second);
+        Added = Delegate.Add([&](int) { Calls.push_back(3); });
+        });
+    Second = Delegate.Add([&](int) { Calls.push_back(2); });
+
+    Delegate.Broadcast(0);
+    const bool firstPass = Calls == std::vector<int>{ 1 } && Delegate.Num() == 1;
+
+    Calls.clear();
+    Delegate.Broadcast(0);
+    const bool secondPass = Calls == std::vector<int>{ 3 };
+
+    // ŵ    ڵδ   
+    const FDelegateHandle Reused = Delegate.Add([&](int) { Calls.push_back(4); });
+    const bool slotReused = static_cast<uint32_t>(Reused) == static_cast<uint32_t>(Self) || static_cast<uint32_t>(Reused) == static_cast<uint32_t>(Second);
+    const bool staleRejected = slotReused && !Delegate.Remove(Self) && !Delegate.Remove(Second);
+    const bool removed = Delegate.Remove(Reused) && Delegate.Remove(Added) && !Delegate.IsBound() && Delegate.Add(TDelegate<int>::HandlerType()) == 0;
+
+    return firstPass && secondPass && staleRejected && removed;
+}
+
+//     TakeDamage ð  Ҵ Ƚ
+void ShowBroadcastInfo(int Hits)
+{
+    AActor* Target = new AActor();
+    UDamageCounter* Counter = new UDamageCounter();
+    Counter->Bind(Target);
+
+    Target->TakeDamage(0.0f, nullptr);
+
+    const size_t before = AllocationCount;
+    auto start = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < Hits; i++)
+    {
+        Target->TakeDamage(0.001f, nullptr);
+    }
+
+    auto end = std::chrono::steady_clock::now();
+    const size_t allocations = AllocationCount - before;
+    const double ns = std::chrono::duration<double, std::nano>(end - start).count() / Hits;
+
+    printf("TakeDamage x %d: %.1f ns/hit (delegate 3), heap allocations %zu\n", Hits, ns, allocations);
+    printf("Handlers called: %s\n", Counter->TotalDamage > 0.0f && Counter->LastHealth < 100.0f ? "O" : "X");
+    printf("Deferred removal during broadcast: %s\n", TestDeferredRemoval() ? "O" : "X");
+
+    delete Target;
+    delete Counter;
+}
+
+// ==========  忡  Ʈ ==========
+// 帶   ڵ鷯 ȣ  (ڵ鷯  ī͸ ΰ  ʵ)
+static thread_local uint64_t HandlerCalls = 0;
+
+void CountCall(int value) { HandlerCalls += static_cast<uint64_t>(value); }
+
+// threads 尡  broadcasts ȣϴ ð (ns/broadcast,  ϳ ).  ȣ ҷȴ Ȯ
+template<typename BroadcastFunc>
+double MeasureBroadcasts(int threads, int broadcasts, uint64_t handlersPerBroadcast, BroadcastFunc&& broadcast, bool& outAllCalled)
+{
+    std::atomic<uint64_t> total{ 0 };
+    std::vector<std::thread> workers;
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (int t = 0; t < threads; t++)
+    {
+        workers.emplace_back([&]() {
+            HandlerCalls = 0;
+
+            for (int i = 0; i < broadcasts; i++)
+            {
+                broadcast();
+            }
+
+            total += HandlerCalls;
+            });
+    }
+
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+
+    auto end = std::chrono::steady_clock::now();
+
+    outAllCalled = total == static_cast<uint64_t>(threads) * broadcasts * handlersPerBroadcast;
+    return std::chrono::duration<double, std::nano>(end - start).count() / broadcasts;
+}
+
+// ڵ鷯 ȿ ڱ ڽ / ڵ鷯 ߰ ( ,  ȣ ݿ)
+bool TestConcurrentSelfRemoval()
+{
+    TConcurrentDelegate<int> Delegate;
+    std::vector<int> Calls;
+    FDelegateHandle Self = 0;
+
+    Self = Delegate.Add([&](int) {
+        Calls.push_back(1);
+        Delegate.Remove(Self);
+        Delegate.Add([&](int) { Calls.push_back(2); });
+        });
+
+    Delegate.Broadcast(0);
+    Delegate.Broadcast(0);
+
+    return Calls == std::vector<int>{ 1, 2 } && Delegate.Num() == 1 && !Delegate.Remove(Self);
+}
+
+// ٸ 忡 ȣ  ڵ鷯 Removeϸ  ȣ  ڿ ƿ
+bool TestRemoveWaitsForBroadcast()
+{
+    TConcurrentDelegate<> Delegate;
+    std::atomic<bool> entered{ false };
+    std::atomic<bool> finished{ false };
+
+    const FDelegateHandle handle = Delegate.Add([&]() {
+        entered = true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        finished = true;
+        });
+
+    std::thread broadcaster([&]() { Delegate.Broadcast(); });
+
+    while (!entered)
+    {
+        std::this_thread::yield();
+    }
+
+    const bool removed = Delegate.Remove(handle);
+    const bool waited = finished;
+
+    broadcaster.join();
+
+    return removed && waited && !Delegate.IsBound();
+}
+
+// ٸ Ʈ ڵ鷯 ȿ θ Remove (ٸ 忡) ȣ  ڵ鷯   ٸ
+bool TestRemoveFromOtherDelegate()
+{
+    TConcurrentDelegate<> Running;
+    TConcurrentDelegate<> Outer;
+    std::atomic<bool> entered{ false };
+    std::atomic<bool> finished{ false };
+    bool removed = false;
+    bool waited = false;
+
+    const FDelegateHandle handle = Running.Add([&]() {
+        entered = true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        finished = true;
+        });
+
+    Outer.Add([&]() {
+        removed = Running.Remove(handle);
+        waited = finished;
+        });
+
+    std::thread broadcaster([&]() { Running.Broadcast(); });
+
+    while (!entered)
+    {
+        std::this_thread::yield();
+    }
+
+    Outer.Broadcast();
+    broadcaster.join();
+
+    return removed && waited && !Running.IsBound();
+}
+
+// Broadcastϴ  Add/Remove ݺϴ 带 Բ  (Broadcast  ,  churns)
+// ŵ ڵ鷯 ĸó ü Remove  Ƿ,  Ⱓ Ʋ  ޸𸮸 
+bool TestConcurrentChurn(int threads, int broadcasts, int churns)
+{
+    TConcurrentDelegate<int> Delegate;
+    Delegate.Add(&CountCall);
+
+    std::atomic<bool> running{ true };
+    std::atomic<int> stale{ 0 };
+    int churned = 0;
+
+    std::thread churner([&]() {
+        for (; running || churned < churns; churned++)
+        {
+            std::vector<int>* payload = new std::vector<int>(16, 7);
+            const FDelegateHandle handle = Delegate.Add([payload, &stale](int) {
+                if ((*payload)[15] != 7)
+                {
+                    stale++;
+                }
+                });
+
+            Delegate.Remove(handle);
+            delete payload;
+        }
+        });
+
+    bool allCalled = false;
+    MeasureBroadcasts(threads, broadcasts, 1, [&]() { Delegate.Broadcast(1); }, allCalled);
+
+    running = false;
+    churner.join();
+
+    return allCalled && stale == 0 && Delegate.Num() == 1 && churned >= churns;
+}
+
+// ڵ鷯 3  Ʈ  尡 Բ Broadcastϴ  (ؽ  TDelegate )
+void ShowConcurrentBroadcastInfo(int Broadcasts)
+{
+    TConcurrentDelegate<int> Concurrent;
+    TDelegate<int> Locked;
+    std::mutex LockedMutex;
+
+    for (int h = 0; h < 3; h++)
+    {
+        Concurrent.Add(&CountCall);
+        Locked.Add(&CountCall);
+    }
+
+    bool allCalled = true;
+
+    for (int threads : { 1, 2, 4, 8 })
+    {
+        bool concurrentCalled = false;
+        bool lockedCalled = false;
+
+        const size_t before = AllocationCount;
+        const double concurrentNs = MeasureBroadcasts(threads, Broadcasts, 3, [&]() { Concurrent.Broadcast(1); }, concurrentCalled);
+        const size_t allocations = AllocationCount - before;
+
+        const double lockedNs = MeasureBroadcasts(threads, Broadcasts, 3, [&]() {
+            std::lock_guard<std::mutex> lock(LockedMutex);
+            Locked.Broadcast(1);
+            }, lockedCalled);
+
+        //  (  )  Broadcast ü Ҵ 
+        printf("%d thread(s) x %d: lock-free %.1f ns/broadcast, mutex %.1f ns/broadcast, heap allocations %zu\n", threads, Broadcasts, concurrentNs, lockedNs, allocations);
+        allCalled = allCalled && concurrentCalled && lockedCalled && allocations < static_cast<size_t>(threads) * 8;
+    }
+
+    printf("All handlers called, no per-broadcast allocation: %s\n", allCalled ? "O" : "X");
+    printf("Self removal inside handler: %s\n", TestConcurrentSelfRemoval() ? "O" : "X");
+    printf("Remove waits for running handler: %s\n", TestRemoveWaitsForBroadcast() ? "O" : "X");
+    printf("Remove from another delegate's handler waits: %s\n", TestRemoveFromOtherDelegate() ? "O" : "X");
+    printf("Add/Remove while broadcasting: %s\n", TestConcurrentChurn(4, Broadcasts / 4, 2000) ? "O" : "X");
+}
+
 // ==========    ==========
 int main()
 {
@@ -260,6 +1149,12 @@ int main()
     printf("\n=== Test 2: Player takes fatal damage ===\n");
     Player->TakeDamage(80.0f, Enemy);
 
+    printf("\n=== Test 3: Broadcast cost ===\n");
+    ShowBroadcastInfo(1000000);
+
+    printf("\n=== Test 4: Concurrent broadcast ===\n");
+    ShowConcurrentBroadcastInfo(200000);
+
     // 
     HealthBar->Unbind(Player);
     delete Player;
@@ -1,195 +1,462 @@
-#include <memory>
+#include <chrono>
+#include <random>
+#include <vector>
 
-#include "Structs.h"
+#include "FMatrix.h"
+#include "Transform.h"
 
-struct FMatrix
+constexpr float Pi = 3.14159265358979f;
+
+constexpr bool NearlyEqual(float A, float B, float Tolerance = 1e-5f)
+{
+	return (A > B ? A - B : B - A) <= Tolerance;
+}
+
+constexpr bool NearlyEqual(const FVector& A, const FVector& B, float Tolerance = 1e-5f)
+{
+	return NearlyEqual(A.x, B.x, Tolerance) && NearlyEqual(A.y, B.y, Tolerance) && NearlyEqual(A.z, B.z, Tolerance);
+}
+
+constexpr bool NearlyEqual(const FMatrix& A, const FMatrix& B, float Tolerance = 1e-5f)
+{
+	for (int r = 0; r < 4; r++)
+	{
+		for (int c = 0; c < 4; c++)
+		{
+			if (!NearlyEqual(A.M[r][c], B.M[r][c], Tolerance))
+			{
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+//  Ÿӿ   ͷ   ȯ:  Y-up(OBJ) -> ޼ Y-up(+z )  ȯ, ⺻ ī޶
+constexpr FMatrix RightToLeftHanded = FMatrix::Scale(FVector(1.0f, 1.0f, -1.0f));
+constexpr FMatrix DefaultView = FMatrix::LookAt(FVector(0.0f, 2.0f, -10.0f), FVector(0.0f, 0.0f, 0.0f), FVector(0.0f, 1.0f, 0.0f));
+constexpr FMatrix DefaultProjection = FMatrix::Perspective(Pi / 3.0f, 16.0f / 9.0f, 0.1f, 1000.0f);
+constexpr FMatrix DefaultViewProjection = DefaultProjection * DefaultView;
+
+//  Ÿ ˻
+static_assert(NearlyEqual(FMatrix::Identity() * FVector(1.0f, 2.0f, 3.0f), FVector(1.0f, 2.0f, 3.0f)), " ");
+static_assert(FMatrix::Zero().Determinant() == 0.0f && FMatrix::Scale(FVector(2.0f, 3.0f, 4.0f)).Determinant() == 24.0f, "Ľ");
+static_assert(NearlyEqual(FMatrix::RotationX(Pi / 2.0f) * FVector(0.0f, 1.0f, 0.0f), FVector(0.0f, 0.0f, 1.0f)), "RotationX: y -> z");
+static_assert(NearlyEqual(FMatrix::RotationY(Pi / 2.0f) * FVector(0.0f, 0.0f, 1.0f), FVector(1.0f, 0.0f, 0.0f)), "RotationY: z -> x");
+static_assert(NearlyEqual(FMatrix::RotationZ(Pi / 2.0f) * FVector(1.0f, 0.0f, 0.0f), FVector(0.0f, 1.0f, 0.0f)), "RotationZ: x -> y");
+static_assert(NearlyEqual(FMatrix::RotationZ(-7.0f * Pi / 6.0f).M[1][0], 0.5f), "sin  ");
+static_assert(NearlyEqual(FMatrix::RotationY(0.7f).Transpose(), FMatrix::RotationY(-0.7f)), "ȸ ġ = ݴ ȸ");
+static_assert(NearlyEqual(FMatrix::Translation(FVector(1.0f, 2.0f, 3.0f)) * FMatrix::Scale(2.0f) * FVector(1.0f, 1.0f, 1.0f), FVector(3.0f, 4.0f, 5.0f)), "ũ  ̵");
+static_assert(NearlyEqual(FMatrix::Translation(FVector(1.0f, 2.0f, 3.0f)).TransformDirection(FVector(1.0f, 0.0f, 0.0f)), FVector(1.0f, 0.0f, 0.0f)), " ̵ ");
+
+constexpr FMatrix TestAffine = FMatrix::Translation(FVector(5.0f, -2.0f, 1.0f)) * FMatrix::RotationX(0.3f) * FMatrix::RotationZ(1.1f) * FMatrix::Scale(FVector(2.0f, 0.5f, 3.0f));
+constexpr FMatrix TestRigid = FMatrix::Translation(FVector(5.0f, -2.0f, 1.0f)) * FMatrix::RotationY(2.0f) * FMatrix::RotationX(-0.4f);
+
+static_assert(NearlyEqual(TestAffine * TestAffine.Inverse(), FMatrix::Identity()), "");
+static_assert(NearlyEqual(TestAffine.InverseAffine(), TestAffine.Inverse()), " ");
+static_assert(NearlyEqual(TestRigid.InverseRigid(), TestRigid.Inverse()), "ü ");
+static_assert(NearlyEqual(FMatrix::Zero().Inverse(), FMatrix::Identity()), "Ư   ");
+static_assert(NearlyEqual(DefaultView * FVector(0.0f, 2.0f, -10.0f), FVector()) && DefaultView.TransformPosition(FVector()).z > 0.0f, "LookAt:  ,  +z");
+static_assert(NearlyEqual((DefaultProjection * FVector(0.0f, 0.0f, 0.1f)).z, 0.0f) && NearlyEqual((DefaultProjection * FVector(0.0f, 0.0f, 1000.0f)).z / 1000.0f, 1.0f, 1e-4f), "   0..1");
+static_assert(NearlyEqual(FMatrix::Orthographic(4.0f, 2.0f, 1.0f, 11.0f) * FVector(2.0f, -1.0f, 6.0f), FVector(1.0f, -1.0f, 0.5f)), " ");
+static_assert(NearlyEqual(DefaultViewProjection, DefaultProjection * DefaultView) && RightToLeftHanded.Determinant() == -1.0f, " ĵ  ");
+
+// ӽ ĳ   ǿڸ  Ƿ auto ޾ ֵ  (ٸ     )
+constexpr auto TemporaryViewProjection = FMatrix::Perspective(Pi / 3.0f, 16.0f / 9.0f, 0.1f, 1000.0f) * FMatrix::LookAt(FVector(0.0f, 2.0f, -10.0f), FVector(0.0f, 0.0f, 0.0f), FVector(0.0f, 1.0f, 0.0f));
+
+static_assert(NearlyEqual(TemporaryViewProjection, DefaultViewProjection), "ӽ   ");
+static_assert((FMatrix::Scale(2.0f) * FMatrix::Scale(3.0f)).Determinant() == 216.0f && NearlyEqual((FMatrix::RotationY(0.7f) * FMatrix::RotationX(0.2f)).Transpose(), FMatrix::RotationX(-0.2f) * FMatrix::RotationY(-0.7f)), "  Ľ/ġ");
+static_assert(NearlyEqual((DefaultProjection * DefaultView).Inverse(), FMatrix(DefaultViewProjection).Inverse(), 1e-4f) && NearlyEqual((FMatrix::Translation(FVector(1.0f, 2.0f, 3.0f)) * FMatrix::RotationZ(0.4f)).InverseRigid(), FMatrix::RotationZ(-0.4f) * FMatrix::Translation(FVector(-1.0f, -2.0f, -3.0f))), "  ");
+
+// FTransform / FQuat:  ο  
+constexpr FTransform TestParent(FQuat::FromAxisAngle(FVector(0.0f, 0.6f, 0.8f), 1.2f), FVector(3.0f, -1.0f, 2.0f), FVector(2.0f, 2.0f, 2.0f));
+constexpr FTransform TestChild(FQuat::FromAxisAngle(FVector(1.0f, 0.0f, 0.0f), -0.5f), FVector(0.5f, 4.0f, -2.0f), FVector(1.0f, 0.5f, 3.0f));
+
+static_assert(NearlyEqual(FQuat::FromAxisAngle(FVector(1.0f, 0.0f, 0.0f), 0.5f).ToMatrix(), FMatrix::RotationX(0.5f)), " X ȸ");
+static_assert(NearlyEqual(FQuat::FromAxisAngle(FVector(0.0f, 1.0f, 0.0f), 0.5f).ToMatrix(), FMatrix::RotationY(0.5f)), " Y ȸ");
+static_assert(NearlyEqual(FQuat::FromAxisAngle(FVector(0.0f, 0.0f, 1.0f), 0.5f).ToMatrix(), FMatrix::RotationZ(0.5f)), " Z ȸ");
+static_assert(NearlyEqual(FQuat::FromRotationMatrix(FMatrix::RotationY(2.5f) * FMatrix::RotationX(-2.9f)).ToMatrix(), FMatrix::RotationY(2.5f) * FMatrix::RotationX(-2.9f)), "ȸ  -> ");
+static_assert(NearlyEqual(TestChild.ToMatrix() * FVector(1.0f, 2.0f, 3.0f), TestChild.TransformPosition(FVector(1.0f, 2.0f, 3.0f))), "TRS  ȯ");
+static_assert(NearlyEqual((TestParent * TestChild).ToMatrix(), TestParent.ToMatrix() * TestChild.ToMatrix(), 1e-4f), "TRS ռ =  ");
+static_assert(NearlyEqual((TestParent * TestParent.Inverse()).ToMatrix(), FMatrix::Identity()), "TRS ȯ");
+static_assert(NearlyEqual(TestParent.Inverse().ToMatrix(), TestParent.ToMatrix().InverseAffine()), "TRS ȯ =  ");
+static_assert(NearlyEqual(FTransform::FromMatrix(TestChild.ToMatrix()).ToMatrix(), TestChild.ToMatrix()), " -> TRS ");
+
+//  :  Į 3 
+FMatrix MultiplyScalar(const FMatrix& A, const FMatrix& B)
 {
-	float M[4][4];
+	FMatrix Result = FMatrix::Zero();
 
-	FMatrix()
+	for (int i = 0; i < 4; i++)
 	{
-		memset(M, 0, sizeof(M));
-		M[0][0] = M[1][1] = M[2][2] = M[3][3] = 1.0f;
+		for (int j = 0; j < 4; j++)
+		{
+			for (int k = 0; k < 4; k++)
+			{
+				Result.M[i][j] += A.M[i][k] * B.M[k][j];
+			}
+		}
 	}
 
-	static FMatrix Identity()
+	return Result;
+}
+
+//  :  μ  (Minor 3x3 , μ 20)
+FMatrix InverseCofactor(const FMatrix& A)
+{
+	float det = 0.0f;
+
+	for (int col = 0; col < 4; col++)
 	{
-		return FMatrix();
+		det += A.M[0][col] * A.Cofactor(0, col);
 	}
 
-	static FMatrix Zero()
+	if (fabs(det) < 1e-6f)
 	{
-		FMatrix Result;
+		return FMatrix::Identity();
+	}
 
-		memset(Result.M, 0, sizeof(Result.M));
+	FMatrix Result = A.Adjugate();
 
-		return Result;
+	for (int i = 0; i < 4; i++)
+	{
+		for (int j = 0; j < 4; j++)
+		{
+			Result.M[i][j] /= det;
+		}
 	}
 
-	//  
-	//FMatrix Transpose() const
-	//{
-	//	FMatrix Result;
-	//
-	//	for (int i = 0; i < 4; i++)
-	//	{
-	//		for (int j = 0; j < 4; j++)
-	//		{
-	//			// if       (if (i!= j))
-	//			Result.M[i][j] = M[j][i];
-	//		}
-	//	}
-	//}
+	return Result;
+}
 
-	// Ѹ 
-	FMatrix Transpose() const {
-		FMatrix Result;
+template<typename F>
+double MeasureMilliseconds(F&& Body)
+{
+	auto Start = chrono::steady_clock::now();
+	Body();
+	return chrono::duration<double, milli>(chrono::steady_clock::now() - Start).count();
+}
 
-		Result.M[0][0] = M[0][0]; Result.M[0][1] = M[1][0]; Result.M[0][2] = M[2][0]; Result.M[0][3] = M[3][0];
-		Result.M[1][0] = M[0][1]; Result.M[1][1] = M[1][1]; Result.M[1][2] = M[2][1]; Result.M[1][3] = M[3][1];
-		Result.M[2][0] = M[0][2]; Result.M[2][1] = M[1][2]; Result.M[2][2] = M[2][2]; Result.M[2][3] = M[3][2];
-		Result.M[3][0] = M[0][3]; Result.M[3][1] = M[1][3]; Result.M[3][2] = M[2][3]; Result.M[3][3] = M[3][3];
+//  N  ؼ Į  ð/  (N ĳÿ  ũ⿡ Repeat ݺ)
+void ShowMultiplyInfo(size_t N, int Repeat)
+{
+	mt19937 Random(11);
+	uniform_real_distribution<float> Value(-2.0f, 2.0f);
 
-		return Result;
-	}
+	vector<FMatrix> A(N), B(N), Simd(N), Scalar(N);
 
-	float Minor(int row, int col) const
+	for (size_t i = 0; i < N; i++)
 	{
-		float SubMatrix[3][3];
-		int i_sub = 0;
-
-		for (int i = 0; i < 4; i++)
+		for (int r = 0; r < 4; r++)
 		{
-			if (i == row)
+			for (int c = 0; c < 4; c++)
 			{
-				continue;
+				A[i].M[r][c] = Value(Random);
+				B[i].M[r][c] = Value(Random);
 			}
+		}
+	}
 
-			int j_sub = 0;
+	const double ScalarMs = MeasureMilliseconds([&]() { for (int r = 0; r < Repeat; r++) for (size_t i = 0; i < N; i++) Scalar[i] = MultiplyScalar(A[i], B[i]); });
+	const double SimdMs = MeasureMilliseconds([&]() { for (int r = 0; r < Repeat; r++) for (size_t i = 0; i < N; i++) Simd[i] = A[i] * B[i]; });
 
-			for (int j = 0; j < 4; j++)
-			{
-				if (j == col)
-				{
-					continue;
-				}
+	float MaxError = 0.0f;
+	bool bTranspose = true;
 
-				SubMatrix[i_sub][j_sub] = M[i][j];
-				j_sub++;
-			}
+	for (size_t i = 0; i < N; i++)
+	{
+		const FMatrix T = A[i].Transpose();
+		const FFloat4 V = FFloat4::Load(B[i].M[0]);
+		float Transformed[4];
+		A[i].TransformVector4(V).Store(Transformed);
 
-			i_sub++;
+		for (int r = 0; r < 4; r++)
+		{
+			const float Expected = A[i].M[r][0] * B[i].M[0][0] + A[i].M[r][1] * B[i].M[0][1] + A[i].M[r][2] * B[i].M[0][2] + A[i].M[r][3] * B[i].M[0][3];
+			MaxError = max(MaxError, fabsf(Transformed[r] - Expected));
+
+			for (int c = 0; c < 4; c++)
+			{
+				MaxError = max(MaxError, fabsf(Simd[i].M[r][c] - Scalar[i].M[r][c]));
+				bTranspose = bTranspose && T.M[r][c] == A[i].M[c][r];
+			}
 		}
+	}
+
+	cout << "===   " << N << " x " << Repeat << "ȸ (" << (SIMD_SSE2 ? (SIMD_FMA ? "SSE2+FMA" : "SSE2") : "Į") << ") ===" << endl;
+	cout << "Į  : " << ScalarMs << " ms" << endl;
+	cout << "SIMD        : " << SimdMs << " ms (" << ScalarMs / SimdMs << ")" << endl;
+	cout << "ִ    : " << MaxError << endl;
+	cout << " ġ / ġ /  ȯ : " << (MaxError < 1e-4f && bTranspose ? "O" : "X") << endl;
+}
 
-		return SubMatrix[0][0] * (SubMatrix[1][1] * SubMatrix[2][2] - SubMatrix[1][2] * SubMatrix[2][1])
-			 - SubMatrix[0][1] * (SubMatrix[1][0] * SubMatrix[2][2] - SubMatrix[1][2] * SubMatrix[2][0])
-			 + SubMatrix[0][2] * (SubMatrix[1][0] * SubMatrix[2][1] - SubMatrix[1][1] * SubMatrix[2][0]);
+//    İ ִ 
+float IdentityError(const FMatrix& A, const FMatrix& B)
+{
+	const FMatrix P = A * B;
+	float Error = 0.0f;
+
+	for (int r = 0; r < 4; r++)
+	{
+		for (int c = 0; c < 4; c++)
+		{
+			Error = max(Error, fabsf(P.M[r][c] - (r == c ? 1.0f : 0.0f)));
+		}
 	}
-	
-	float Cofactor(int row, int col) const
+
+	return Error;
+}
+
+// ȸ(+ũ) + ̵ ȯ N   ð Ȯ 
+void ShowInverseInfo(size_t N, int Repeat)
+{
+	mt19937 Random(13);
+	uniform_real_distribution<float> Unit(-1.0f, 1.0f);
+
+	vector<FMatrix> Rigid(N), Scaled(N), Out(N);
+
+	for (size_t i = 0; i < N; i++)
 	{
-		float minor = Minor(row, col);
-		float sign = ((row + col) % 2 == 0) ? 1.0f : -1.0f;
+		//   ȸ (ε帮Խ) + ̵, Scaled ະ ũ
+		const FVector Axis(Unit(Random), Unit(Random), Unit(Random) + 2.0f);
+		const float InvLength = 1.0f / sqrtf(Dot(Axis, Axis));
+		const float x = Axis.x * InvLength, y = Axis.y * InvLength, z = Axis.z * InvLength;
+		const float Angle = Unit(Random) * 3.14159265f;
+		const float co = cosf(Angle), si = sinf(Angle), t = 1.0f - co;
+		const float Rotation[3][3] =
+		{
+			{ t * x * x + co,     t * x * y - si * z, t * x * z + si * y },
+			{ t * x * y + si * z, t * y * y + co,     t * y * z - si * x },
+			{ t * x * z - si * y, t * y * z + si * x, t * z * z + co     },
+		};
+		const float Scale[3] = { 1.5f + Unit(Random), 1.5f + Unit(Random), 1.5f + Unit(Random) };
+
+		for (int r = 0; r < 3; r++)
+		{
+			const float Translation = Unit(Random) * 100.0f;
+
+			for (int c = 0; c < 3; c++)
+			{
+				Rigid[i].M[r][c] = Rotation[r][c];
+				Scaled[i].M[r][c] = Rotation[r][c] * Scale[c];
+			}
 
-		return sign * minor;
+			Rigid[i].M[r][3] = Scaled[i].M[r][3] = Translation;
+		}
 	}
 
-	float Determinant() const
+	float Errors[4] = {};
+	double Times[4] = {};
+
+	auto Run = [&](int Method, const vector<FMatrix>& Input, auto&& Invert)
 	{
-		float det = 0.0f;
+		Times[Method] = MeasureMilliseconds([&]() { for (int r = 0; r < Repeat; r++) for (size_t i = 0; i < N; i++) Out[i] = Invert(Input[i]); });
 
-		for (int col = 0; col < 4; col++)
+		for (size_t i = 0; i < N; i++)
 		{
-			det += M[0][col] * Cofactor(0, col);
+			Errors[Method] = max(Errors[Method], IdentityError(Input[i], Out[i]));
 		}
+	};
+
+	Run(0, Scaled, [](const FMatrix& A) { return InverseCofactor(A); });
+	Run(1, Scaled, [](const FMatrix& A) { return A.Inverse(); });
+	Run(2, Scaled, [](const FMatrix& A) { return A.InverseAffine(); });
+	Run(3, Rigid, [](const FMatrix& A) { return A.InverseRigid(); });
 
-		return det;
+	// Ư  TryInverse false
+	FMatrix Singular;
+	Singular.M[2][0] = 1.0f; Singular.M[2][1] = 0.0f; Singular.M[2][2] = 0.0f;
+	FMatrix Unused;
+	const bool bReportsSingular = !Singular.TryInverse(Unused) && Scaled[0].TryInverse(Unused);
+
+	const char* Names[4] = { "μ ()", "2x2 Ľ", "    ", "ü    " };
+
+	cout << "===  " << N << " x " << Repeat << "ȸ ===" << endl;
+
+	for (int Method = 0; Method < 4; Method++)
+	{
+		cout << Names[Method] << " : " << Times[Method] << " ms (" << Times[0] / Times[Method] << "),  " << Errors[Method] << endl;
 	}
 
-	FMatrix Adjugate() const
+	cout << "Ȯ / Ư   : " << (max(max(Errors[1], Errors[2]), Errors[3]) < 1e-3f && bReportsSingular ? "O" : "X") << endl;
+}
+
+//  :       (ʺ )
+FMatrix MultiplyEager(const FMatrix& A, const FMatrix& B)
+{
+	return (A * B).Eval();
+}
+
+// νϽ N Projection * View * Model * p  (ʺ  )  (ʺ - ) ؼ 
+void ShowChainInfo(size_t N, int Repeat)
+{
+	mt19937 Random(17);
+	uniform_real_distribution<float> Value(-2.0f, 2.0f);
+
+	FMatrix Projection, View;
+	vector<FMatrix> Models(N);
+	vector<FVector> Points(N), Eager(N), Lazy(N);
+
+	for (int r = 0; r < 4; r++)
 	{
-		FMatrix adj;
+		for (int c = 0; c < 4; c++)
+		{
+			Projection.M[r][c] = Value(Random);
+			View.M[r][c] = Value(Random);
+		}
+	}
 
-		for (int i = 0; i < 4; i++)
+	for (size_t i = 0; i < N; i++)
+	{
+		for (int r = 0; r < 3; r++)
 		{
-			for (int j = 0; j < 4; j++)
+			for (int c = 0; c < 4; c++)
 			{
-				adj.M[j][i] = Cofactor(i, j);
+				Models[i].M[r][c] = Value(Random);
 			}
 		}
 
-		return adj;
+		Points[i] = FVector(Value(Random), Value(Random), Value(Random));
 	}
 
-	FMatrix Inverse() const
-	{
-		FMatrix Result;
-		float det = Determinant();
+	// ӽ      auto ޾    忡 ᵵ ƾ  (ǿڸ  )
+	auto TemporaryChain = FMatrix(Projection) * FMatrix(View);
+	const FMatrix TemporaryExpected = MultiplyEager(Projection, View);
+	const bool bTemporarySafe = NearlyEqual(TemporaryChain, TemporaryExpected, 0.0f) && NearlyEqual(TemporaryChain.Inverse(), TemporaryExpected.Inverse(), 0.0f);
 
-		if (fabs(det) < 1e-6f)
-		{
-			return Identity();
-		}
+	const double EagerMs = MeasureMilliseconds([&]() { for (int r = 0; r < Repeat; r++) for (size_t i = 0; i < N; i++) Eager[i] = MultiplyEager(MultiplyEager(Projection, View), Models[i]) * Points[i]; });
+	const double LazyMs = MeasureMilliseconds([&]() { for (int r = 0; r < Repeat; r++) for (size_t i = 0; i < N; i++) Lazy[i] = Projection * View * Models[i] * Points[i]; });
+
+	// ķ   ĵ  İ ƾ 
+	float VectorError = 0.0f;
+	float MatrixError = 0.0f;
 
-		FMatrix adj = Adjugate();
+	for (size_t i = 0; i < N; i++)
+	{
+		const FMatrix Expected = MultiplyEager(MultiplyEager(Projection, View), Models[i]);
+		const FMatrix Fused = Projection * View * Models[i];
+		const float Scale = 1.0f + fabsf(Eager[i].x) + fabsf(Eager[i].y) + fabsf(Eager[i].z);
 
-		float InvDet = 1.0f / det;
+		VectorError = max(VectorError, (fabsf(Lazy[i].x - Eager[i].x) + fabsf(Lazy[i].y - Eager[i].y) + fabsf(Lazy[i].z - Eager[i].z)) / Scale);
 
-		for (int i = 0; i < 4; i++)
+		for (int r = 0; r < 4; r++)
 		{
-			for (int j = 0; j < 4; j++)
+			for (int c = 0; c < 4; c++)
 			{
-				Result.M[i][j] = InvDet * adj.M[i][j];
+				MatrixError = max(MatrixError, fabsf(Fused.M[r][c] - Expected.M[r][c]));
 			}
 		}
+	}
+
+	cout << "===    P * V * M * p, " << N << " x " << Repeat << "ȸ ===" << endl;
+	cout << "   : " << EagerMs << " ms" << endl;
+	cout << "        : " << LazyMs << " ms (" << EagerMs / LazyMs << ")" << endl;
+	cout << "   " << VectorError << ",   " << MatrixError << " : " << (VectorError < 1e-5f && MatrixError == 0.0f ? "O" : "X") << endl;
+	cout << "ӽ     /  ȣ : " << (bTemporarySafe ? "O" : "X") << endl;
+}
+
+//   Ÿ(sinf/cosf/sqrtf, SIMD ) ҷ  Ÿӿ    
+void ShowConstexprInfo()
+{
+	volatile float Fov = Pi / 3.0f;
+	volatile float EyeZ = -10.0f;
 
-		return Result;
+	const FMatrix View = FMatrix::LookAt(FVector(0.0f, 2.0f, EyeZ), FVector(0.0f, 0.0f, 0.0f), FVector(0.0f, 1.0f, 0.0f));
+	const FMatrix Projection = FMatrix::Perspective(Fov, 16.0f / 9.0f, 0.1f, 1000.0f);
+	const FMatrix ViewProjection = Projection * View;
+
+	cout << "=== constexpr  ===" << endl;
+	cout << " Ÿ  Ÿ  ġ : " << (NearlyEqual(ViewProjection, DefaultViewProjection, 1e-5f) && NearlyEqual(View, DefaultView) ? "O" : "X") << endl;
+}
+
+//  : ,  1, Slerp ߰ ʿ  
+bool CheckQuatInterpolation()
+{
+	const FQuat A = FQuat::FromAxisAngle(FVector(0.0f, 1.0f, 0.0f), 0.3f);
+	const FQuat B = FQuat::FromAxisAngle(FVector(0.0f, 0.0f, 1.0f), 2.1f);
+	const FQuat NegB(-B.x, -B.y, -B.z, -B.w);
+	const FQuat Mid = Slerp(A, B, 0.5f);
+
+	auto Angle = [](const FQuat& P, const FQuat& Q) { return 2.0f * acosf(min(1.0f, fabsf(Dot(P, Q)))); };
+	auto SameRotation = [](const FQuat& P, const FQuat& Q) { return NearlyEqual(P.ToMatrix(), Q.ToMatrix(), 1e-5f); };
+
+	return SameRotation(Slerp(A, B, 0.0f), A) && SameRotation(Slerp(A, B, 1.0f), B) && SameRotation(Nlerp(A, B, 1.0f), B)
+		&& NearlyEqual(Dot(Nlerp(A, B, 0.3f), Nlerp(A, B, 0.3f)), 1.0f)
+		&& NearlyEqual(Angle(A, Mid), Angle(Mid, B), 1e-4f)
+		&& SameRotation(Slerp(A, NegB, 0.5f), Mid) && SameRotation(Nlerp(A, NegB, 0.5f), Nlerp(A, B, 0.5f));
+}
+
+// 4  Ʈ( ) NumNodes  ȯ : / FMatrix ο FTransformHierarchy(SoA) 
+void ShowHierarchyInfo(size_t NumNodes, int Repeat)
+{
+	mt19937 Random(19);
+	uniform_real_distribution<float> Unit(-1.0f, 1.0f);
+
+	vector<int> Parents(NumNodes);
+	vector<FMatrix> LocalMatrices(NumNodes), WorldMatrices(NumNodes);
+	FTransformHierarchy Hierarchy;
+
+	for (size_t i = 0; i < NumNodes; i++)
+	{
+		Parents[i] = i == 0 ? -1 : static_cast<int>((i - 1) / 4);
 	}
 
-	FVector operator*(const FVector& V) const
+	const bool bAccepted = Hierarchy.SetParents(Parents);
+
+	for (size_t i = 0; i < NumNodes; i++)
 	{
-		return FVector
-		(
-			V.x * M[0][0] + V.x * M[0][1] + V.y * M[0][2] + V.z * M[0][3],
-			V.x * M[1][0] + V.x * M[1][1] + V.y * M[1][2] + V.z * M[1][3],
-			V.x * M[2][0] + V.x * M[2][1] + V.y * M[2][2] + V.z * M[2][3]
-		);
+		const FQuat Rotation = FQuat(Unit(Random), Unit(Random), Unit(Random), Unit(Random) + 2.0f).GetNormalized();
+		const float Scale = 1.0f + Unit(Random) * 0.1f;
+		const FTransform Local(Rotation, FVector(Unit(Random), Unit(Random), Unit(Random)), FVector(Scale, Scale, Scale));
+
+		Hierarchy.SetLocal(i, Local);
+		LocalMatrices[i] = Local.ToMatrix();
 	}
 
-	FMatrix operator*(const FMatrix& Other) const
+	auto UpdateMatrices = [&]()
 	{
-		FMatrix Result = FMatrix::Zero();
+		WorldMatrices[0] = LocalMatrices[0];
 
-		for (int i = 0; i < 4; i++)
+		for (size_t i = 1; i < NumNodes; i++)
 		{
-			for (int j = 0; j < 4; j++)
-			{
-				for (int k = 0; k < 4; k++)
-				{
-					Result.M[i][j] += M[i][k] * Other.M[k][j];
-				}
-			}
+			WorldMatrices[i] = WorldMatrices[Parents[i]] * LocalMatrices[i];
 		}
+	};
 
-		return Result;
-	}
+	UpdateMatrices();
+	Hierarchy.UpdateWorld();
 
-	void ShowMatrix()
+	const double MatrixMs = MeasureMilliseconds([&]() { for (int r = 0; r < Repeat; r++) UpdateMatrices(); }) / Repeat;
+	const double TransformMs = MeasureMilliseconds([&]() { for (int r = 0; r < Repeat; r++) Hierarchy.UpdateWorld(); }) / Repeat;
+
+	//  ʿ 常   (̵ ũ⿡ ϴ   )
+	float MaxError = 0.0f;
+
+	for (size_t i = 0; i < NumNodes; i += 7)
 	{
-		cout << "Determinant = " << Determinant() << endl << endl;
-		
-		for (int i = 0; i < 4; i++)
+		const FMatrix World = Hierarchy.GetWorldMatrix(i);
+		const FMatrix& Expected = WorldMatrices[i];
+
+		for (int r = 0; r < 3; r++)
 		{
-			for (int j = 0; j < 4; j++)
+			for (int c = 0; c < 4; c++)
 			{
-				cout << i << "  " << j << "  = " << M[i][j];
-				cout << " ";
+				MaxError = max(MaxError, fabsf(World.M[r][c] - Expected.M[r][c]) / (1.0f + fabsf(Expected.M[r][c])));
 			}
-
-			cout << endl;
 		}
 	}
-};
+
+	//   ƴ  ź
+	FTransformHierarchy Unordered;
+	const bool bRejects = !Unordered.SetParents({ -1, 2, 0 }) && !Unordered.SetParents({ -1, 0, 1, 0 }) && Unordered.SetParents({ -1, -1, 0, 1, 2 });
+
+	cout << "===    ( " << NumNodes << ",  " << Hierarchy.NumLevels() << ", " << Repeat << "ȸ ) ===" << endl;
+	cout << "FMatrix     : " << MatrixMs << " ms ( б/ " << 2 * sizeof(FMatrix) << " Ʈ)" << endl;
+	cout << "FTransform SoA  : " << TransformMs << " ms ( б/ " << 2 * 10 * sizeof(float) << " Ʈ, " << MatrixMs / TransformMs << ")" << endl;
+	cout << "    " << MaxError << ",   ˻ : " << (bAccepted && bRejects && MaxError < 1e-4f ? "O" : "X") << endl;
+	cout << " Nlerp / Slerp : " << (CheckQuatInterpolation() ? "O" : "X") << endl;
+}
 
 int main()
 {
@@ -214,5 +481,13 @@ int main()
 
 	Mul.ShowMatrix();
 
+	cout << endl << endl;
+
+	ShowMultiplyInfo(1 << 12, 256);
+	ShowInverseInfo(1 << 12, 64);
+	ShowChainInfo(1 << 12, 256);
+	ShowConstexprInfo();
+	ShowHierarchyInfo(1 << 20, 10);
+
 	return 0;
 }
\ No newline at end of file
@@ -0,0 +1,731 @@
+#pragma once
+
+#include <cmath>
+#include <type_traits>
+
+#include "Structs.h"
+#include "SimdFloat4.h"
+
+template<typename L, typename R>
+struct TMatrixProduct;
+
+//    ̸ true (C++17̶ std::is_constant_evaluated  Ϸ  Լ)
+// SIMD/ǥ  Լ constexpr ƴϹǷ ̰ɷ  Ÿӿ Į θ Ž
+constexpr bool IsConstantEvaluated()
+{
+	return __builtin_is_constant_evaluated();
+}
+
+// constexpr :  Ÿӿ double Ϲ, Ÿӿ sqrtf
+constexpr float ConstSqrt(float Value)
+{
+	if (!IsConstantEvaluated())
+	{
+		return sqrtf(Value);
+	}
+
+	if (!(Value > 0.0f))
+	{
+		return 0.0f;
+	}
+
+	double x = Value > 1.0f ? Value : 1.0;
+
+	for (int i = 0; i < 64; i++)
+	{
+		const double Next = 0.5 * (x + Value / x);
+
+		if (Next == x)
+		{
+			break;
+		}
+
+		x = Next;
+	}
+
+	return static_cast<float>(x);
+}
+
+// constexpr sin/cos:  Ÿӿ 90    Ϸ ޼ (|r| <= 45  ̸ double е), Ÿӿ sinf/cosf
+constexpr void ConstSinCos(float Radians, float& OutSin, float& OutCos)
+{
+	if (!IsConstantEvaluated())
+	{
+		OutSin = sinf(Radians);
+		OutCos = cosf(Radians);
+		return;
+	}
+
+	constexpr double HalfPi = 1.57079632679489661923;
+	const double Quadrants = Radians / HalfPi;
+	const long long k = static_cast<long long>(Quadrants >= 0.0 ? Quadrants + 0.5 : Quadrants - 0.5);
+	const double r = Radians - k * HalfPi;
+
+	double Sin = 0.0, Cos = 0.0;
+	double SinTerm = r, CosTerm = 1.0;
+
+	for (int n = 1; n <= 10; n++)
+	{
+		Sin += SinTerm;
+		Cos += CosTerm;
+		SinTerm *= -r * r / ((2 * n) * (2 * n + 1));
+		CosTerm *= -r * r / ((2 * n - 1) * (2 * n));
+	}
+
+	switch (((k % 4) + 4) % 4)
+	{
+	case 0: OutSin = static_cast<float>(Sin);	OutCos = static_cast<float>(Cos);	break;
+	case 1: OutSin = static_cast<float>(Cos);	OutCos = static_cast<float>(-Sin);	break;
+	case 2: OutSin = static_cast<float>(-Sin);	OutCos = static_cast<float>(-Cos);	break;
+	default: OutSin = static_cast<float>(-Cos);	OutCos = static_cast<float>(Sin);	break;
+	}
+}
+
+//   Ծ (p' = M * p, ̵  ).  ϳ FFloat4 ϳ µ 16Ʈ 
+// SIMD δ SIMD_SSE2/SIMD_FMA   Ÿӿ ,  Į 
+// ͷ Ÿ̶ /ġ///  Ŀ    ( Ŀ Į )
+// ǥ: ޼ (+z ), Ŭ   0 <= z <= w
+struct alignas(16) FMatrix
+{
+	float M[4][4];
+
+	constexpr FMatrix()
+		: M{ { 1.0f, 0.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 1.0f, 0.0f }, { 0.0f, 0.0f, 0.0f, 1.0f } }
+	{
+	}
+
+	static constexpr FMatrix Identity()
+	{
+		return FMatrix();
+	}
+
+	static constexpr FMatrix Zero()
+	{
+		FMatrix Result;
+
+		Result.M[0][0] = Result.M[1][1] = Result.M[2][2] = Result.M[3][3] = 0.0f;
+
+		return Result;
+	}
+
+	static constexpr FMatrix Translation(const FVector& T)
+	{
+		FMatrix Result;
+
+		Result.M[0][3] = T.x;
+		Result.M[1][3] = T.y;
+		Result.M[2][3] = T.z;
+
+		return Result;
+	}
+
+	static constexpr FMatrix Scale(const FVector& S)
+	{
+		FMatrix Result;
+
+		Result.M[0][0] = S.x;
+		Result.M[1][1] = S.y;
+		Result.M[2][2] = S.z;
+
+		return Result;
+	}
+
+	static constexpr FMatrix Scale(float S)
+	{
+		return Scale(FVector(S, S, S));
+	}
+
+	//  ȸ ().   ⿡   ݽð
+	static constexpr FMatrix RotationX(float Radians)
+	{
+		float s = 0.0f, c = 0.0f;
+		ConstSinCos(Radians, s, c);
+
+		FMatrix Result;
+
+		Result.M[1][1] = c;	Result.M[1][2] = -s;
+		Result.M[2][1] = s;	Result.M[2][2] = c;
+
+		return Result;
+	}
+
+	static constexpr FMatrix RotationY(float Radians)
+	{
+		float s = 0.0f, c = 0.0f;
+		ConstSinCos(Radians, s, c);
+
+		FMatrix Result;
+
+		Result.M[0][0] = c;		Result.M[0][2] = s;
+		Result.M[2][0] = -s;	Result.M[2][2] = c;
+
+		return Result;
+	}
+
+	static constexpr FMatrix RotationZ(float Radians)
+	{
+		float s = 0.0f, c = 0.0f;
+		ConstSinCos(Radians, s, c);
+
+		FMatrix Result;
+
+		Result.M[0][0] = c;	Result.M[0][1] = -s;
+		Result.M[1][0] = s;	Result.M[1][1] = c;
+
+		return Result;
+	}
+
+	//  : Eye Target  ī޶  (ī޶  = +z, Up  = +y)
+	// Up ü ϸ  
+	static constexpr FMatrix LookAt(const FVector& Eye, const FVector& Target, const FVector& Up)
+	{
+		const FVector Forward(Target.x - Eye.x, Target.y - Eye.y, Target.z - Eye.z);
+		const FVector Side = Cross(Up, Forward);
+		const float ForwardLength = ConstSqrt(Dot(Forward, Forward));
+		const float SideLength = ConstSqrt(Dot(Side, Side));
+
+		if (ForwardLength < 1e-12f || SideLength < 1e-12f)
+		{
+			return Identity();
+		}
+
+		const FVector z(Forward.x / ForwardLength, Forward.y / ForwardLength, Forward.z / ForwardLength);
+		const FVector x(Side.x / SideLength, Side.y / SideLength, Side.z / SideLength);
+		const FVector y = Cross(z, x);
+		const FVector Axes[3] = { x, y, z };
+
+		FMatrix Result;
+
+		for (int i = 0; i < 3; i++)
+		{
+			Result.M[i][0] = Axes[i].x;
+			Result.M[i][1] = Axes[i].y;
+			Result.M[i][2] = Axes[i].z;
+			Result.M[i][3] = -Dot(Axes[i], Eye);
+		}
+
+		return Result;
+	}
+
+	//   ( þ߰ ). ī޶  z = Near ->  0, z = Far ->  1 (w  )
+	static constexpr FMatrix Perspective(float FovY, float Aspect, float Near, float Far)
+	{
+		float s = 0.0f, c = 0.0f;
+		ConstSinCos(FovY * 0.5f, s, c);
+
+		const float Focal = c / s;
+		FMatrix Result = Zero();
+
+		Result.M[0][0] = Focal / Aspect;
+		Result.M[1][1] = Focal;
+		Result.M[2][2] = Far / (Far - Near);
+		Result.M[2][3] = -Near * Far / (Far - Near);
+		Result.M[3][2] = 1.0f;
+
+		return Result;
+	}
+
+	//  .   Width x Height , z = Near ->  0, z = Far ->  1
+	static constexpr FMatrix Orthographic(float Width, float Height, float Near, float Far)
+	{
+		FMatrix Result;
+
+		Result.M[0][0] = 2.0f / Width;
+		Result.M[1][1] = 2.0f / Height;
+		Result.M[2][2] = 1.0f / (Far - Near);
+		Result.M[2][3] = -Near / (Far - Near);
+
+		return Result;
+	}
+
+	//  
+	//FMatrix Transpose() const
+	//{
+	//	FMatrix Result;
+	//
+	//	for (int i = 0; i < 4; i++)
+	//	{
+	//		for (int j = 0; j < 4; j++)
+	//		{
+	//			// if       (if (i!= j))
+	//			Result.M[i][j] = M[j][i];
+	//		}
+	//	}
+	//}
+
+	FFloat4 Row(int i) const
+	{
+		return FFloat4::LoadAligned(M[i]);
+	}
+
+	void SetRow(int i, FFloat4 Value)
+	{
+		Value.StoreAligned(M[i]);
+	}
+
+	//   ƴϰ SSE2  TransposeSimd
+	constexpr FMatrix Transpose() const
+	{
+#if SIMD_SSE2
+		if (!IsConstantEvaluated())
+		{
+			return TransposeSimd();
+		}
+#endif
+
+		// Ѹ 
+		FMatrix Result;
+
+		Result.M[0][0] = M[0][0]; Result.M[0][1] = M[1][0]; Result.M[0][2] = M[2][0]; Result.M[0][3] = M[3][0];
+		Result.M[1][0] = M[0][1]; Result.M[1][1] = M[1][1]; Result.M[1][2] = M[2][1]; Result.M[1][3] = M[3][1];
+		Result.M[2][0] = M[0][2]; Result.M[2][1] = M[1][2]; Result.M[2][2] = M[2][2]; Result.M[2][3] = M[3][2];
+		Result.M[3][0] = M[0][3]; Result.M[3][1] = M[1][3]; Result.M[3][2] = M[2][3]; Result.M[3][3] = M[3][3];
+
+		return Result;
+	}
+
+	float Minor(int row, int col) const
+	{
+		float SubMatrix[3][3];
+		int i_sub = 0;
+
+		for (int i = 0; i < 4; i++)
+		{
+			if (i == row)
+			{
+				continue;
+			}
+
+			int j_sub = 0;
+
+			for (int j = 0; j < 4; j++)
+			{
+				if (j == col)
+				{
+					continue;
+				}
+
+				SubMatrix[i_sub][j_sub] = M[i][j];
+				j_sub++;
+			}
+
+			i_sub++;
+		}
+
+		return SubMatrix[0][0] * (SubMatrix[1][1] * SubMatrix[2][2] - SubMatrix[1][2] * SubMatrix[2][1])
+			 - SubMatrix[0][1] * (SubMatrix[1][0] * SubMatrix[2][2] - SubMatrix[1][2] * SubMatrix[2][0])
+			 + SubMatrix[0][2] * (SubMatrix[1][0] * SubMatrix[2][1] - SubMatrix[1][1] * SubMatrix[2][0]);
+	}
+	
+	float Cofactor(int row, int col) const
+	{
+		float minor = Minor(row, col);
+		float sign = ((row + col) % 2 == 0) ? 1.0f : -1.0f;
+
+		return sign * minor;
+	}
+
+	//   (s) Ʒ  (c) 2x2 Ľ 6. Ľİ   12  
+	constexpr void SubDeterminants(float (&s)[6], float (&c)[6]) const
+	{
+		s[0] = M[0][0] * M[1][1] - M[0][1] * M[1][0];
+		s[1] = M[0][0] * M[1][2] - M[0][2] * M[1][0];
+		s[2] = M[0][0] * M[1][3] - M[0][3] * M[1][0];
+		s[3] = M[0][1] * M[1][2] - M[0][2] * M[1][1];
+		s[4] = M[0][1] * M[1][3] - M[0][3] * M[1][1];
+		s[5] = M[0][2] * M[1][3] - M[0][3] * M[1][2];
+
+		c[0] = M[2][0] * M[3][1] - M[2][1] * M[3][0];
+		c[1] = M[2][0] * M[3][2] - M[2][2] * M[3][0];
+		c[2] = M[2][0] * M[3][3] - M[2][3] * M[3][0];
+		c[3] = M[2][1] * M[3][2] - M[2][2] * M[3][1];
+		c[4] = M[2][1] * M[3][3] - M[2][3] * M[3][1];
+		c[5] = M[2][2] * M[3][3] - M[2][3] * M[3][2];
+	}
+
+	constexpr float Determinant() const
+	{
+		float s[6] = {}, c[6] = {};
+		SubDeterminants(s, c);
+
+		return s[0] * c[5] - s[1] * c[4] + s[2] * c[3] + s[3] * c[2] - s[4] * c[1] + s[5] * c[0];
+	}
+
+	FMatrix Adjugate() const
+	{
+		FMatrix adj;
+
+		for (int i = 0; i < 4; i++)
+		{
+			for (int j = 0; j < 4; j++)
+			{
+				adj.M[j][i] = Cofactor(i, j);
+			}
+		}
+
+		return adj;
+	}
+
+	//     OutInverse  true, |Ľ| < Tolerance false (OutInverse ״)
+	constexpr bool TryInverse(FMatrix& OutInverse, float Tolerance = 1e-6f) const
+	{
+		float s[6] = {}, c[6] = {};
+		SubDeterminants(s, c);
+
+		const float det = s[0] * c[5] - s[1] * c[4] + s[2] * c[3] + s[3] * c[2] - s[4] * c[1] + s[5] * c[0];
+
+		if ((det < 0.0f ? -det : det) < Tolerance)
+		{
+			return false;
+		}
+
+		const float InvDet = 1.0f / det;
+		float (&R)[4][4] = OutInverse.M;
+
+		R[0][0] = ( M[1][1] * c[5] - M[1][2] * c[4] + M[1][3] * c[3]) * InvDet;
+		R[0][1] = (-M[0][1] * c[5] + M[0][2] * c[4] - M[0][3] * c[3]) * InvDet;
+		R[0][2] = ( M[3][1] * s[5] - M[3][2] * s[4] + M[3][3] * s[3]) * InvDet;
+		R[0][3] = (-M[2][1] * s[5] + M[2][2] * s[4] - M[2][3] * s[3]) * InvDet;
+
+		R[1][0] = (-M[1][0] * c[5] + M[1][2] * c[2] - M[1][3] * c[1]) * InvDet;
+		R[1][1] = ( M[0][0] * c[5] - M[0][2] * c[2] + M[0][3] * c[1]) * InvDet;
+		R[1][2] = (-M[3][0] * s[5] + M[3][2] * s[2] - M[3][3] * s[1]) * InvDet;
+		R[1][3] = ( M[2][0] * s[5] - M[2][2] * s[2] + M[2][3] * s[1]) * InvDet;
+
+		R[2][0] = ( M[1][0] * c[4] - M[1][1] * c[2] + M[1][3] * c[0]) * InvDet;
+		R[2][1] = (-M[0][0] * c[4] + M[0][1] * c[2] - M[0][3] * c[0]) * InvDet;
+		R[2][2] = ( M[3][0] * s[4] - M[3][1] * s[2] + M[3][3] * s[0]) * InvDet;
+		R[2][3] = (-M[2][0] * s[4] + M[2][1] * s[2] - M[2][3] * s[0]) * InvDet;
+
+		R[3][0] = (-M[1][0] * c[3] + M[1][1] * c[1] - M[1][2] * c[0]) * InvDet;
+		R[3][1] = ( M[0][0] * c[3] - M[0][1] * c[1] + M[0][2] * c[0]) * InvDet;
+		R[3][2] = (-M[3][0] * s[3] + M[3][1] * s[1] - M[3][2] * s[0]) * InvDet;
+		R[3][3] = ( M[2][0] * s[3] - M[2][1] * s[1] + M[2][2] * s[0]) * InvDet;
+
+		return true;
+	}
+
+	// Ư ̸   ( ʿϸ TryInverse)
+	constexpr FMatrix Inverse() const
+	{
+		FMatrix Result;
+		TryInverse(Result);
+
+		return Result;
+	}
+
+	//   (0, 0, 0, 1) ȯ : 3x3 κ    , ̵ -A^-1 * t
+	// 3x3 κ Ư ̸  
+	constexpr FMatrix InverseAffine() const
+	{
+		const FVector a0(M[0][0], M[1][0], M[2][0]);
+		const FVector a1(M[0][1], M[1][1], M[2][1]);
+		const FVector a2(M[0][2], M[1][2], M[2][2]);
+
+		// A^-1  = (a1 x a2, a2 x a0, a0 x a1) / det
+		const FVector r0 = Cross(a1, a2);
+		const FVector r1 = Cross(a2, a0);
+		const FVector r2 = Cross(a0, a1);
+		const float det = Dot(a0, r0);
+
+		if ((det < 0.0f ? -det : det) < 1e-6f)
+		{
+			return Identity();
+		}
+
+		const float InvDet = 1.0f / det;
+		const FVector Rows[3] = { r0, r1, r2 };
+		FMatrix Result;
+
+		for (int i = 0; i < 3; i++)
+		{
+			Result.M[i][0] = Rows[i].x * InvDet;
+			Result.M[i][1] = Rows[i].y * InvDet;
+			Result.M[i][2] = Rows[i].z * InvDet;
+			Result.M[i][3] = -(Result.M[i][0] * M[0][3] + Result.M[i][1] * M[1][3] + Result.M[i][2] * M[2][3]);
+		}
+
+		return Result;
+	}
+
+	// ȸ + ̵ ִ ȯ  (ũ 1, ): R^T, -R^T * t
+	constexpr FMatrix InverseRigid() const
+	{
+		FMatrix Result;
+
+		for (int i = 0; i < 3; i++)
+		{
+			Result.M[i][0] = M[0][i];
+			Result.M[i][1] = M[1][i];
+			Result.M[i][2] = M[2][i];
+			Result.M[i][3] = -(M[0][i] * M[0][3] + M[1][i] * M[1][3] + M[2][i] * M[2][3]);
+		}
+
+		return Result;
+	}
+
+	//  ȯ (TransformPosition ). 迭 ü MeshTransform.h TransformPositions
+	constexpr FVector operator*(const FVector& V) const
+	{
+		return TransformPosition(V);
+	}
+
+	//   *  (V^T * M).  = sum_k V[k] * M k (V[k]  ü ļ ϰ )
+	//   A * B i (A i) * B  (TMatrixProduct) ึ ̰ ̾ θ
+	FFloat4 MultiplyRow(FFloat4 V) const
+	{
+		FFloat4 R = SplatLane<0>(V) * Row(0);
+
+		R = MultiplyAdd(SplatLane<1>(V), Row(1), R);
+		R = MultiplyAdd(SplatLane<2>(V), Row(2), R);
+
+		return MultiplyAdd(SplatLane<3>(V), Row(3), R);
+	}
+
+	// (x, y, z, w) ȯ.  ġؼ  4     ؼ 
+	FFloat4 TransformVector4(FFloat4 V) const
+	{
+		FFloat4 C0 = Row(0), C1 = Row(1), C2 = Row(2), C3 = Row(3);
+
+		Transpose4(C0, C1, C2, C3);
+
+		FFloat4 R = SplatLane<0>(V) * C0;
+
+		R = MultiplyAdd(SplatLane<1>(V), C1, R);
+		R = MultiplyAdd(SplatLane<2>(V), C2, R);
+
+		return MultiplyAdd(SplatLane<3>(V), C3, R);
+	}
+
+	//  ȯ (w = 1, ̵ ).  ̸  w  
+	constexpr FVector TransformPosition(const FVector& P) const
+	{
+		return FVector
+		(
+			M[0][0] * P.x + M[0][1] * P.y + M[0][2] * P.z + M[0][3],
+			M[1][0] * P.x + M[1][1] * P.y + M[1][2] * P.z + M[1][3],
+			M[2][0] * P.x + M[2][1] * P.y + M[2][2] * P.z + M[2][3]
+		);
+	}
+
+	//  ȯ (w = 0, ̵ )
+	constexpr FVector TransformDirection(const FVector& D) const
+	{
+		return FVector
+		(
+			M[0][0] * D.x + M[0][1] * D.y + M[0][2] * D.z,
+			M[1][0] * D.x + M[1][1] * D.y + M[1][2] * D.z,
+			M[2][0] * D.x + M[2][1] * D.y + M[2][2] * D.z
+		);
+	}
+
+	void ShowMatrix()
+	{
+		cout << "Determinant = " << Determinant() << endl << endl;
+		
+		for (int i = 0; i < 4; i++)
+		{
+			for (int j = 0; j < 4; j++)
+			{
+				cout << i << "  " << j << "  = " << M[i][j];
+				cout << " ";
+			}
+
+			cout << endl;
+		}
+	}
+
+private:
+	template<typename L, typename R>
+	friend struct TMatrixProduct;
+
+	//  Ҹ ٷ   ( ķ äٰ ٽ  ʵ)
+	struct ENoInit {};
+
+	explicit FMatrix(ENoInit)
+	{
+	}
+
+	FMatrix TransposeSimd() const
+	{
+		FMatrix Result(ENoInit{});
+		FFloat4 R0 = Row(0), R1 = Row(1), R2 = Row(2), R3 = Row(3);
+
+		Transpose4(R0, R1, R2, R3);
+
+		Result.SetRow(0, R0);
+		Result.SetRow(1, R1);
+		Result.SetRow(2, R2);
+		Result.SetRow(3, R3);
+
+		return Result;
+	}
+};
+
+//    ø: A * B * C ٷ  ʰ ǿڸ  ξٰ ̴     
+//  - FMatrix   ึ (A i) * B * C Ϳ ̾  (߰  )
+//  - Ϳ ϸ ʺ -  : (P * V * M) * p = P * (V * (M * p))
+// ̸ ִ (ް) , ӽ ()  Ƿ auto VP = FMatrix::Perspective(...) * View; 
+// (       ־ )
+template<typename T>
+struct TIsMatrixExpression : false_type {};
+
+template<>
+struct TIsMatrixExpression<FMatrix> : true_type {};
+
+template<typename L, typename R>
+struct TIsMatrixExpression<TMatrixProduct<L, R>> : true_type {};
+
+// ǿڸ  : ް FMatrix , ӽ FMatrix (  ۸ ),   
+template<typename T>
+using TMatrixOperand = conditional_t<is_lvalue_reference_v<T> && is_same_v<decay_t<T>, FMatrix>, const FMatrix&, decay_t<T>>;
+
+// L, R TMatrixOperand    (const FMatrix&, FMatrix Ǵ ٸ TMatrixProduct)
+template<typename L, typename R>
+struct TMatrixProduct
+{
+	L Left;
+	R Right;
+
+	template<typename InL, typename InR>
+	constexpr TMatrixProduct(InL&& InLeft, InR&& InRight)
+		: Left(forward<InL>(InLeft))
+		, Right(forward<InR>(InRight))
+	{
+	}
+
+	// (L * R) i = (L i) * R
+	FFloat4 Row(int i) const
+	{
+		return Right.MultiplyRow(Left.Row(i));
+	}
+
+	// V^T * (L * R) = (V^T * L) * R
+	FFloat4 MultiplyRow(FFloat4 V) const
+	{
+		return Right.MultiplyRow(Left.MultiplyRow(V));
+	}
+
+	// (L * R) * V = L * (R * V)
+	FFloat4 TransformVector4(FFloat4 V) const
+	{
+		return Left.TransformVector4(Right.TransformVector4(V));
+	}
+
+	//  ȯ (w = 1). ߰ ܰ w ״ ѱǷ FMatrix   ȯ Ͱ 
+	constexpr FVector TransformPosition(const FVector& P) const
+	{
+		if (IsConstantEvaluated())
+		{
+			return Eval().TransformPosition(P);
+		}
+
+		float Out[4] = {};
+
+		TransformVector4(FFloat4::Set(P.x, P.y, P.z, 1.0f)).Store(Out);
+
+		return FVector(Out[0], Out[1], Out[2]);
+	}
+
+	//  ȯ (w = 0)
+	constexpr FVector TransformDirection(const FVector& D) const
+	{
+		if (IsConstantEvaluated())
+		{
+			return Eval().TransformDirection(D);
+		}
+
+		float Out[4] = {};
+
+		TransformVector4(FFloat4::Set(D.x, D.y, D.z, 0.0f)).Store(Out);
+
+		return FVector(Out[0], Out[1], Out[2]);
+	}
+
+	//  Ŀ  ķ   Į 3 
+	constexpr FMatrix Eval() const
+	{
+		if (!IsConstantEvaluated())
+		{
+			return EvalRows();
+		}
+
+		const FMatrix A = Left;
+		const FMatrix B = Right;
+		FMatrix Result = FMatrix::Zero();
+
+		for (int i = 0; i < 4; i++)
+		{
+			for (int j = 0; j < 4; j++)
+			{
+				for (int k = 0; k < 4; k++)
+				{
+					Result.M[i][j] += A.M[i][k] * B.M[k][j];
+				}
+			}
+		}
+
+		return Result;
+	}
+
+	constexpr operator FMatrix() const
+	{
+		return Eval();
+	}
+
+	// FMatrix   Ŀ ٷ ҷ ǵ   ѱ ((A * B).Inverse() )
+	constexpr FMatrix Transpose() const
+	{
+		return Eval().Transpose();
+	}
+
+	constexpr float Determinant() const
+	{
+		return Eval().Determinant();
+	}
+
+	constexpr bool TryInverse(FMatrix& OutInverse, float Tolerance = 1e-6f) const
+	{
+		return Eval().TryInverse(OutInverse, Tolerance);
+	}
+
+	constexpr FMatrix Inverse() const
+	{
+		return Eval().Inverse();
+	}
+
+	constexpr FMatrix InverseAffine() const
+	{
+		return Eval().InverseAffine();
+	}
+
+	constexpr FMatrix InverseRigid() const
+	{
+		return Eval().InverseRigid();
+	}
+
+private:
+	FMatrix EvalRows() const
+	{
+		FMatrix Result(FMatrix::ENoInit{});
+
+		for (int i = 0; i < 4; i++)
+		{
+			Result.SetRow(i, Row(i));
+		}
+
+		return Result;
+	}
+};
+
+template<typename L, typename R, typename = enable_if_t<TIsMatrixExpression<decay_t<L>>::value && TIsMatrixExpression<decay_t<R>>::value>>
+constexpr TMatrixProduct<TMatrixOperand<L>, TMatrixOperand<R>> operator*(L&& Left, R&& Right)
+{
+	return TMatrixProduct<TMatrixOperand<L>, TMatrixOperand<R>>(forward<L>(Left), forward<R>(Right));
+}
+
+template<typename L, typename R>
+constexpr FVector operator*(const TMatrixProduct<L, R>& Product, const FVector& V)
+{
+	return Product.TransformPosition(V);
+}
@@ -0,0 +1,165 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+//  ü б  ޸  (  Data ٷ Ľ)
+struct FMappedFile
+{
+	const char* Data = nullptr;
+	size_t Size = 0;
+
+	FMappedFile() = default;
+	FMappedFile(const FMappedFile&) = delete;
+	FMappedFile& operator=(const FMappedFile&) = delete;
+
+	~FMappedFile()
+	{
+		Close();
+	}
+
+	bool Open(const std::string& FileName)
+	{
+		Close();
+
+#ifdef _WIN32
+		FileHandle = CreateFileA(FileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+
+		if (FileHandle == INVALID_HANDLE_VALUE)
+		{
+			return false;
+		}
+
+		LARGE_INTEGER FileSize;
+
+		if (!GetFileSizeEx(FileHandle, &FileSize))
+		{
+			Close();
+			return false;
+		}
+
+		Size = static_cast<size_t>(FileSize.QuadPart);
+
+		//     Ƿ Data == nullptr, Size == 0   ó
+		if (Size == 0)
+		{
+			return true;
+		}
+
+		MappingHandle = CreateFileMappingA(FileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+		if (MappingHandle == nullptr)
+		{
+			Close();
+			return false;
+		}
+
+		Data = static_cast<const char*>(MapViewOfFile(MappingHandle, FILE_MAP_READ, 0, 0, 0));
+#else
+		FileDescriptor = open(FileName.c_str(), O_RDONLY);
+
+		if (FileDescriptor < 0)
+		{
+			return false;
+		}
+
+		struct stat FileStat;
+
+		if (fstat(FileDescriptor, &FileStat) != 0)
+		{
+			Close();
+			return false;
+		}
+
+		Size = static_cast<size_t>(FileStat.st_size);
+
+		if (Size == 0)
+		{
+			return true;
+		}
+
+		void* Mapped = mmap(nullptr, Size, PROT_READ, MAP_PRIVATE, FileDescriptor, 0);
+
+		if (Mapped != MAP_FAILED)
+		{
+			madvise(Mapped, Size, MADV_SEQUENTIAL);
+			Data = static_cast<const char*>(Mapped);
+		}
+#endif
+
+		if (Data == nullptr)
+		{
+			Close();
+			return false;
+		}
+
+		return true;
+	}
+
+	void Close()
+	{
+#ifdef _WIN32
+		if (Data)
+		{
+			UnmapViewOfFile(Data);
+		}
+
+		if (MappingHandle)
+		{
+			CloseHandle(MappingHandle);
+		}
+
+		if (FileHandle != INVALID_HANDLE_VALUE)
+		{
+			CloseHandle(FileHandle);
+		}
+
+		MappingHandle = nullptr;
+		FileHandle = INVALID_HANDLE_VALUE;
+#else
+		if (Data)
+		{
+			munmap(const_cast<char*>(Data), Size);
+		}
+
+		if (FileDescriptor >= 0)
+		{
+			close(FileDescriptor);
+		}
+
+		FileDescriptor = -1;
+#endif
+
+		Data = nullptr;
+		Size = 0;
+	}
+
+	std::string_view View() const
+	{
+		return std::string_view(Data, Size);
+	}
+
+private:
+#ifdef _WIN32
+	HANDLE FileHandle = INVALID_HANDLE_VALUE;
+	HANDLE MappingHandle = nullptr;
+#else
+	int FileDescriptor = -1;
+#endif
+};
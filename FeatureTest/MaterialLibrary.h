@@ -0,0 +1,44 @@
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+
+#include "Structs.h"
+#include "NameTable.h"
+#include "MtlParser.h"
+
+//  MTL    ΰ FName( ID) ã ̺
+//  ̸   Ͽ   ߰  
+class FMaterialLibrary
+{
+public:
+	void Add(const vector<MtlMaterial>& InMaterials)
+	{
+		for (const MtlMaterial& Material : InMaterials)
+		{
+			const FName Name(Material.Name);
+
+			if (IndexOfName.find(Name) == IndexOfName.end())
+			{
+				IndexOfName.emplace(Name, Materials.size());
+				Materials.push_back(Material);
+			}
+		}
+	}
+
+	//  nullptr
+	const MtlMaterial* Find(FName Name) const
+	{
+		auto It = IndexOfName.find(Name);
+		return It != IndexOfName.end() ? &Materials[It->second] : nullptr;
+	}
+
+	size_t Num() const
+	{
+		return Materials.size();
+	}
+
+private:
+	vector<MtlMaterial> Materials;
+	unordered_map<FName, size_t> IndexOfName;
+};
@@ -0,0 +1,979 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <future>
+#include <mutex>
+#include <vector>
+
+#include "Structs.h"
+#include "ThreadPool.h"
+#include "SimdFloat4.h"
+#include "MeshNormals.h"
+
+struct FRay
+{
+	FVector Origin;
+	FVector Direction;	// ȭ ʾƵ  (T Direction  )
+	float TMin = 0.0f;
+	float TMax = INFINITY;
+};
+
+struct FRayHit
+{
+	float T = INFINITY;
+	uint32_t Triangle = UINT32_MAX;		//  ﰢ ȣ (UStaticMesh::Indices / 3 )
+	float U = 0.0f;						//  °/ °  ߽ ǥ
+	float V = 0.0f;
+
+	bool IsHit() const
+	{
+		return Triangle != UINT32_MAX;
+	}
+};
+
+struct FClosestPoint
+{
+	FVector Point;
+	float DistanceSquared = INFINITY;
+	uint32_t Triangle = UINT32_MAX;
+
+	bool IsHit() const
+	{
+		return Triangle != UINT32_MAX;
+	}
+};
+
+// SAH   / leaf ϳ ִ ﰢ  /  ˻ (ﰢ ˻ = 1)
+constexpr uint32_t BVHNumBins = 16;
+constexpr uint32_t BVHMaxLeafTriangles = 4;
+constexpr float BVHTraversalCost = 1.0f;
+
+//  ̺ʹ   ʰ leaf  (ȸ   ũ ϵ)
+constexpr int BVHMaxDepth = 64;
+constexpr int BVHStackSize = BVHMaxDepth * 3 + 4;
+
+// IntersectPacket    ȸϴ   ( ũ Ʈ )
+constexpr uint32_t BVHPacketSize = 32;
+
+//  ڽ Child . Count == 0δ Ʈ(0 ) Ű   е 
+constexpr uint32_t BVHEmptyChild = UINT32_MAX;
+
+// ڽ 4 ڽ ະ   .  ϳ ڽ 4 SIMD   ˻. 128Ʈ = ĳ  2
+struct alignas(64) FBVHNode
+{
+	float Bounds[6][4];		// MinX, MinY, MinZ, MaxX, MaxY, MaxZ ( ڽ Min = +inf, Max = -inf ׻ )
+	uint32_t Child[4];		//   ȣ, leaf Triangles  ù ﰢ,  ڽ̸ BVHEmptyChild
+	uint32_t Count[4];		// 0̸  (Ǵ  ڽ), ƴϸ leaf ﰢ 
+};
+
+// leaf  ٽ þ ﰢ (Moller-Trumbore  ϳ +  )
+struct FBVHTriangle
+{
+	FVector V0;
+	FVector E1;
+	FVector E2;
+	uint32_t Index;
+};
+
+//     δ ȸ .  ȣ  (Min/Max) ̸  
+struct FBVHRay
+{
+	FFloat4 Origin[3];
+	FFloat4 InvDirection[3];
+	int Near[3];
+	int Far[3];
+	float TMin;
+
+	FBVHRay() = default;
+
+	explicit FBVHRay(const FRay& Ray)
+	{
+		const float O[3] = { Ray.Origin.x, Ray.Origin.y, Ray.Origin.z };
+		const float D[3] = { Ray.Direction.x, Ray.Direction.y, Ray.Direction.z };
+
+		for (int a = 0; a < 3; a++)
+		{
+			const float Inv = 1.0f / D[a];
+
+			Origin[a] = FFloat4::Splat(O[a]);
+			InvDirection[a] = FFloat4::Splat(Inv);
+			Near[a] = (Inv >= 0.0f) ? a : a + 3;
+			Far[a] = (Inv >= 0.0f) ? a + 3 : a;
+		}
+
+		TMin = Ray.TMin;
+	}
+};
+
+//  ϳ ڽ ڽ 4   ˻ؼ  ڽ Ʈ ũ ȯ (OutNear = ڽĺ  Ÿ)
+//   NaN(0 * inf)̸ Min/Max ٸ   Ƿ   õ
+inline int IntersectChildren(const FBVHNode& Node, const FBVHRay& Ray, float TMax, float (&OutNear)[4])
+{
+	const FFloat4 NearX = (FFloat4::Load(Node.Bounds[Ray.Near[0]]) - Ray.Origin[0]) * Ray.InvDirection[0];
+	const FFloat4 NearY = (FFloat4::Load(Node.Bounds[Ray.Near[1]]) - Ray.Origin[1]) * Ray.InvDirection[1];
+	const FFloat4 NearZ = (FFloat4::Load(Node.Bounds[Ray.Near[2]]) - Ray.Origin[2]) * Ray.InvDirection[2];
+	const FFloat4 FarX = (FFloat4::Load(Node.Bounds[Ray.Far[0]]) - Ray.Origin[0]) * Ray.InvDirection[0];
+	const FFloat4 FarY = (FFloat4::Load(Node.Bounds[Ray.Far[1]]) - Ray.Origin[1]) * Ray.InvDirection[1];
+	const FFloat4 FarZ = (FFloat4::Load(Node.Bounds[Ray.Far[2]]) - Ray.Origin[2]) * Ray.InvDirection[2];
+
+	const FFloat4 Near = Max(NearX, Max(NearY, Max(NearZ, FFloat4::Splat(Ray.TMin))));
+	const FFloat4 Far = Min(FarX, Min(FarY, Min(FarZ, FFloat4::Splat(TMax))));
+
+	Near.Store(OutNear);
+
+	return ~MoveMask(LessThan(Far, Near)) & 0xF;
+}
+
+//  ڽ ڽ 4 Ÿ  (ȿ  0)
+inline void DistanceSquaredToChildren(const FBVHNode& Node, const FFloat4 (&Point)[3], float (&OutDistanceSquared)[4])
+{
+	const FFloat4 Zero = FFloat4::Splat(0.0f);
+	FFloat4 Sum = Zero;
+
+	for (int a = 0; a < 3; a++)
+	{
+		const FFloat4 Below = FFloat4::Load(Node.Bounds[a]) - Point[a];
+		const FFloat4 Above = Point[a] - FFloat4::Load(Node.Bounds[a + 3]);
+		const FFloat4 D = Max(Max(Below, Above), Zero);
+
+		Sum = Sum + D * D;
+	}
+
+	Sum.Store(OutDistanceSquared);
+}
+
+//  Moller-Trumbore. TMin <= T < TMax  true
+inline bool IntersectTriangle(const FBVHTriangle& Triangle, const FRay& Ray, float TMax, float& OutT, float& OutU, float& OutV)
+{
+	const FVector P = Cross(Ray.Direction, Triangle.E2);
+	const float Det = Dot(Triangle.E1, P);
+
+	if (Det == 0.0f)
+	{
+		return false;
+	}
+
+	const float InvDet = 1.0f / Det;
+	const FVector S(Ray.Origin.x - Triangle.V0.x, Ray.Origin.y - Triangle.V0.y, Ray.Origin.z - Triangle.V0.z);
+	const float U = Dot(S, P) * InvDet;
+
+	if (U < 0.0f || U > 1.0f)
+	{
+		return false;
+	}
+
+	const FVector Q = Cross(S, Triangle.E1);
+	const float V = Dot(Ray.Direction, Q) * InvDet;
+
+	if (V < 0.0f || U + V > 1.0f)
+	{
+		return false;
+	}
+
+	const float T = Dot(Triangle.E2, Q) * InvDet;
+
+	if (!(T >= Ray.TMin && T < TMax))
+	{
+		return false;
+	}
+
+	OutT = T;
+	OutU = U;
+	OutV = V;
+
+	return true;
+}
+
+// ﰢ  P    (Ericson, Real-Time Collision Detection 5.1.5)
+inline FVector ClosestPointOnTriangle(const FVector& P, const FBVHTriangle& Triangle)
+{
+	const FVector& A = Triangle.V0;
+	const FVector& AB = Triangle.E1;
+	const FVector& AC = Triangle.E2;
+	const FVector AP(P.x - A.x, P.y - A.y, P.z - A.z);
+
+	auto At = [&](float S, float T)
+	{
+		return FVector(A.x + AB.x * S + AC.x * T, A.y + AB.y * S + AC.y * T, A.z + AB.z * S + AC.z * T);
+	};
+
+	const float D1 = Dot(AB, AP);
+	const float D2 = Dot(AC, AP);
+
+	if (D1 <= 0.0f && D2 <= 0.0f)
+	{
+		return A;
+	}
+
+	const FVector BP(AP.x - AB.x, AP.y - AB.y, AP.z - AB.z);
+	const float D3 = Dot(AB, BP);
+	const float D4 = Dot(AC, BP);
+
+	if (D3 >= 0.0f && D4 <= D3)
+	{
+		return At(1.0f, 0.0f);
+	}
+
+	const float VC = D1 * D4 - D3 * D2;
+
+	if (VC <= 0.0f && D1 >= 0.0f && D3 <= 0.0f)
+	{
+		return At(D1 / (D1 - D3), 0.0f);
+	}
+
+	const FVector CP(AP.x - AC.x, AP.y - AC.y, AP.z - AC.z);
+	const float D5 = Dot(AB, CP);
+	const float D6 = Dot(AC, CP);
+
+	if (D6 >= 0.0f && D5 <= D6)
+	{
+		return At(0.0f, 1.0f);
+	}
+
+	const float VB = D5 * D2 - D1 * D6;
+
+	if (VB <= 0.0f && D2 >= 0.0f && D6 <= 0.0f)
+	{
+		return At(0.0f, D2 / (D2 - D6));
+	}
+
+	const float VA = D3 * D6 - D5 * D4;
+
+	if (VA <= 0.0f && (D4 - D3) >= 0.0f && (D5 - D6) >= 0.0f)
+	{
+		const float W = (D4 - D3) / ((D4 - D3) + (D5 - D6));
+		return At(1.0f - W, W);
+	}
+
+	const float Denom = 1.0f / (VA + VB + VC);
+
+	return At(VB * Denom, VC * Denom);
+}
+
+// UStaticMesh ﰢ  4-ary BVH.   켱   迭, ﰢ leaf   
+// : binned SAH   帶 ִ 3 ݺؼ ڽ 4 , ū Ʈ Ǯ ķ 
+//  const  忡 ÿ ȣص 
+class FMeshBVH
+{
+public:
+	void Build(const UStaticMesh& InUStaticMesh, FThreadPool& Pool = FThreadPool::Get())
+	{
+		Nodes.clear();
+		Triangles.clear();
+		Bounds = FBox();
+
+		const vector<Vertex>& Vertices = InUStaticMesh.Vertices;
+		const vector<int>& Indices = InUStaticMesh.Indices;
+		const size_t NumTriangles = Indices.size() / 3;
+
+		if (NumTriangles == 0)
+		{
+			return;
+		}
+
+		FBuildContext Context(Pool);
+		Context.TriangleBounds.resize(NumTriangles);
+		Context.Centroids.resize(NumTriangles);
+		Context.Order.resize(NumTriangles);
+
+		ParallelForRanges(Pool, NumTriangles, MinElementsPerTask, [&](size_t Begin, size_t End)
+		{
+			for (size_t t = Begin; t < End; t++)
+			{
+				FBox Box;
+
+				for (int c = 0; c < 3; c++)
+				{
+					Box.Add(Vertices[Indices[t * 3 + c]].Location);
+				}
+
+				Context.TriangleBounds[t] = Box;
+				Context.Centroids[t] = Box.Center();
+				Context.Order[t] = static_cast<uint32_t>(t);
+			}
+		});
+
+		FBuildRange Root;
+		Root.Count = static_cast<uint32_t>(NumTriangles);
+
+		for (size_t t = 0; t < NumTriangles; t++)
+		{
+			Root.Bounds.Add(Context.TriangleBounds[t]);
+			Root.CentroidBounds.Add(Context.Centroids[t]);
+		}
+
+		Bounds = Root.Bounds;
+		BuildNode(Context, &Root, 1, 0, Nodes);
+
+		Triangles.resize(NumTriangles);
+
+		ParallelForRanges(Pool, NumTriangles, MinElementsPerTask, [&](size_t Begin, size_t End)
+		{
+			for (size_t i = Begin; i < End; i++)
+			{
+				const uint32_t t = Context.Order[i];
+				const FVector& A = Vertices[Indices[t * 3 + 0]].Location;
+				const FVector& B = Vertices[Indices[t * 3 + 1]].Location;
+				const FVector& C = Vertices[Indices[t * 3 + 2]].Location;
+
+				Triangles[i] = { A, FVector(B.x - A.x, B.y - A.y, B.z - A.z), FVector(C.x - A.x, C.y - A.y, C.z - A.z), t };
+			}
+		});
+	}
+
+	//    ( false, OutHit ʱⰪ)
+	bool Intersect(const FRay& Ray, FRayHit& OutHit) const
+	{
+		OutHit = FRayHit();
+
+		if (Nodes.empty())
+		{
+			return false;
+		}
+
+		const FBVHRay Traversal(Ray);
+		float TMax = Ray.TMax;
+
+		FStackEntry Stack[BVHStackSize];
+		int StackSize = 0;
+		Stack[StackSize++] = { 0, 0, Ray.TMin, 0 };
+
+		while (StackSize > 0)
+		{
+			const FStackEntry Entry = Stack[--StackSize];
+
+			//  ڿ    ã ǳʶ
+			if (Entry.Distance >= TMax)
+			{
+				continue;
+			}
+
+			if (Entry.Count > 0)
+			{
+				for (uint32_t i = Entry.Index; i < Entry.Index + Entry.Count; i++)
+				{
+					if (IntersectTriangle(Triangles[i], Ray, TMax, OutHit.T, OutHit.U, OutHit.V))
+					{
+						TMax = OutHit.T;
+						OutHit.Triangle = Triangles[i].Index;
+					}
+				}
+
+				continue;
+			}
+
+			const FBVHNode& Node = Nodes[Entry.Index];
+			float Near[4];
+			const int HitMask = IntersectChildren(Node, Traversal, TMax, Near);
+
+			PushChildren(Node, HitMask, Near, 0, Stack, StackSize);
+		}
+
+		return OutHit.IsHit();
+	}
+
+	// ƹ  ϳ ִ (ü/׸ , ã  )
+	bool IntersectAny(const FRay& Ray) const
+	{
+		if (Nodes.empty())
+		{
+			return false;
+		}
+
+		const FBVHRay Traversal(Ray);
+
+		FStackEntry Stack[BVHStackSize];
+		int StackSize = 0;
+		Stack[StackSize++] = { 0, 0, Ray.TMin, 0 };
+
+		while (StackSize > 0)
+		{
+			const FStackEntry Entry = Stack[--StackSize];
+
+			if (Entry.Count > 0)
+			{
+				float T, U, V;
+
+				for (uint32_t i = Entry.Index; i < Entry.Index + Entry.Count; i++)
+				{
+					if (IntersectTriangle(Triangles[i], Ray, Ray.TMax, T, U, V))
+					{
+						return true;
+					}
+				}
+
+				continue;
+			}
+
+			const FBVHNode& Node = Nodes[Entry.Index];
+			float Near[4];
+			const int HitMask = IntersectChildren(Node, Traversal, Ray.TMax, Near);
+
+			PushChildren(Node, HitMask, Near, 0, Stack, StackSize);
+		}
+
+		return false;
+	}
+
+	//    BVHPacketSize   ȸ (带   о     ˻)
+	// ī޶ ó   ϼ ̵.   Intersect 
+	void IntersectPacket(const FRay* Rays, FRayHit* OutHits, size_t Count) const
+	{
+		for (size_t Base = 0; Base < Count; Base += BVHPacketSize)
+		{
+			const uint32_t NumRays = static_cast<uint32_t>(min<size_t>(BVHPacketSize, Count - Base));
+			const FRay* PacketRays = Rays + Base;
+			FRayHit* PacketHits = OutHits + Base;
+
+			float TMax[BVHPacketSize];
+
+			for (uint32_t r = 0; r < NumRays; r++)
+			{
+				PacketHits[r] = FRayHit();
+				TMax[r] = PacketRays[r].TMax;
+			}
+
+			if (Nodes.empty())
+			{
+				continue;
+			}
+
+			FBVHRay Traversals[BVHPacketSize];
+
+			for (uint32_t r = 0; r < NumRays; r++)
+			{
+				Traversals[r] = FBVHRay(PacketRays[r]);
+			}
+
+			FStackEntry Stack[BVHStackSize];
+			int StackSize = 0;
+			Stack[StackSize++] = { 0, 0, 0.0f, (NumRays == BVHPacketSize) ? 0xFFFFFFFFu : ((1u << NumRays) - 1) };
+
+			while (StackSize > 0)
+			{
+				const FStackEntry Entry = Stack[--StackSize];
+
+				if (Entry.Count > 0)
+				{
+					for (uint32_t r = 0; r < NumRays; r++)
+					{
+						if ((Entry.Mask & (1u << r)) == 0)
+						{
+							continue;
+						}
+
+						FRayHit& Hit = PacketHits[r];
+
+						for (uint32_t i = Entry.Index; i < Entry.Index + Entry.Count; i++)
+						{
+							if (IntersectTriangle(Triangles[i], PacketRays[r], TMax[r], Hit.T, Hit.U, Hit.V))
+							{
+								TMax[r] = Hit.T;
+								Hit.Triangle = Triangles[i].Index;
+							}
+						}
+					}
+
+					continue;
+				}
+
+				const FBVHNode& Node = Nodes[Entry.Index];
+				uint32_t ChildMasks[4] = {};
+				float OrderNear[4] = { INFINITY, INFINITY, INFINITY, INFINITY };
+				bool bHasOrder = false;
+
+				for (uint32_t r = 0; r < NumRays; r++)
+				{
+					if ((Entry.Mask & (1u << r)) == 0)
+					{
+						continue;
+					}
+
+					float Near[4];
+					const int HitMask = IntersectChildren(Node, Traversals[r], TMax[r], Near);
+
+					for (int c = 0; c < 4; c++)
+					{
+						ChildMasks[c] |= (HitMask & (1 << c)) ? (1u << r) : 0u;
+					}
+
+					// ڽ 湮   ó   
+					if (!bHasOrder && HitMask != 0)
+					{
+						copy(Near, Near + 4, OrderNear);
+						bHasOrder = true;
+					}
+				}
+
+				int HitMask = 0;
+
+				for (int c = 0; c < 4; c++)
+				{
+					HitMask |= ChildMasks[c] ? (1 << c) : 0;
+				}
+
+				PushChildren(Node, HitMask, OrderNear, ChildMasks, Stack, StackSize);
+			}
+		}
+	}
+
+	// MaxDistance ȿ Point   ǥ   ( false)
+	bool FindClosestPoint(const FVector& Point, float MaxDistance, FClosestPoint& OutResult) const
+	{
+		OutResult = FClosestPoint();
+
+		if (Nodes.empty())
+		{
+			return false;
+		}
+
+		const FFloat4 Query[3] = { FFloat4::Splat(Point.x), FFloat4::Splat(Point.y), FFloat4::Splat(Point.z) };
+		float BestDistanceSquared = (MaxDistance < INFINITY) ? MaxDistance * MaxDistance : INFINITY;
+
+		FStackEntry Stack[BVHStackSize];
+		int StackSize = 0;
+		Stack[StackSize++] = { 0, 0, 0.0f, 0 };
+
+		while (StackSize > 0)
+		{
+			const FStackEntry Entry = Stack[--StackSize];
+
+			if (Entry.Distance > BestDistanceSquared)
+			{
+				continue;
+			}
+
+			if (Entry.Count > 0)
+			{
+				for (uint32_t i = Entry.Index; i < Entry.Index + Entry.Count; i++)
+				{
+					const FVector Candidate = ClosestPointOnTriangle(Point, Triangles[i]);
+					const FVector Delta(Candidate.x - Point.x, Candidate.y - Point.y, Candidate.z - Point.z);
+					const float DistanceSquared = Dot(Delta, Delta);
+
+					if (DistanceSquared <= BestDistanceSquared)
+					{
+						BestDistanceSquared = DistanceSquared;
+						OutResult.Point = Candidate;
+						OutResult.DistanceSquared = DistanceSquared;
+						OutResult.Triangle = Triangles[i].Index;
+					}
+				}
+
+				continue;
+			}
+
+			const FBVHNode& Node = Nodes[Entry.Index];
+			float DistanceSquared[4];
+			DistanceSquaredToChildren(Node, Query, DistanceSquared);
+
+			int HitMask = 0;
+
+			for (int c = 0; c < 4; c++)
+			{
+				HitMask |= (DistanceSquared[c] <= BestDistanceSquared) ? (1 << c) : 0;
+			}
+
+			PushChildren(Node, HitMask, DistanceSquared, 0, Stack, StackSize);
+		}
+
+		return OutResult.IsHit();
+	}
+
+	const FBox& GetBounds() const
+	{
+		return Bounds;
+	}
+
+	size_t NumNodes() const
+	{
+		return Nodes.size();
+	}
+
+	size_t NumTriangles() const
+	{
+		return Triangles.size();
+	}
+
+	size_t GetDataSize() const
+	{
+		return Nodes.size() * sizeof(FBVHNode) + Triangles.size() * sizeof(FBVHTriangle);
+	}
+
+private:
+	// Count > 0̸ leaf (Index = ù ﰢ), ƴϸ  . Distance  Ÿ() Ǵ Ÿ ()
+	struct FStackEntry
+	{
+		uint32_t Index;
+		uint32_t Count;
+		float Distance;
+		uint32_t Mask;		// IntersectPacket:  ڽ   Ʈ
+	};
+
+	// HitMask ڽ  ͺ ׾Ƽ  ͺ   (ChildMasks  ڽĺ  ũ )
+	//  ڽ ڽ ˻縦 ص (MaxDistance inf ֱ ˻ inf <= inf)  
+	static void PushChildren(const FBVHNode& Node, int HitMask, const float (&Distance)[4], const uint32_t* ChildMasks, FStackEntry* Stack, int& StackSize)
+	{
+		int Order[4];
+		int NumHits = 0;
+
+		for (int c = 0; c < 4; c++)
+		{
+			if ((HitMask & (1 << c)) == 0 || Node.Child[c] == BVHEmptyChild)
+			{
+				continue;
+			}
+
+			// Ÿ   
+			int i = NumHits++;
+
+			for (; i > 0 && Distance[Order[i - 1]] < Distance[c]; i--)
+			{
+				Order[i] = Order[i - 1];
+			}
+
+			Order[i] = c;
+		}
+
+		for (int i = 0; i < NumHits; i++)
+		{
+			const int c = Order[i];
+			Stack[StackSize++] = { Node.Child[c], Node.Count[c], Distance[c], ChildMasks ? ChildMasks[c] : 0u };
+		}
+	}
+
+	struct FBuildContext
+	{
+		FThreadPool& Pool;
+		vector<FBox> TriangleBounds;
+		vector<FVector> Centroids;
+		vector<uint32_t> Order;		// ϸ鼭  ڸ  (Ʈ ġ ʾƼ ķ  )
+
+		explicit FBuildContext(FThreadPool& InPool)
+			: Pool(InPool)
+		{
+		}
+	};
+
+	// Order[First, First + Count)    ﰢ ڽ / ߽ ڽ
+	struct FBuildRange
+	{
+		uint32_t First = 0;
+		uint32_t Count = 0;
+		FBox Bounds;
+		FBox CentroidBounds;
+	};
+
+	struct FBin
+	{
+		FBox Bounds;
+		FBox CentroidBounds;
+		uint32_t Count = 0;
+	};
+
+	// binned SAH Range ѷ .  ͺ leaf θ false
+	static bool SplitRange(FBuildContext& Context, const FBuildRange& Range, FBuildRange& OutLeft, FBuildRange& OutRight)
+	{
+		if (Range.Count <= 1)
+		{
+			return false;
+		}
+
+		float Origin[3], Scale[3];
+
+		for (int a = 0; a < 3; a++)
+		{
+			const float Extent = GetAxis(Range.CentroidBounds.Max, a) - GetAxis(Range.CentroidBounds.Min, a);
+
+			Origin[a] = GetAxis(Range.CentroidBounds.Min, a);
+			Scale[a] = (Extent > 0.0f) ? BVHNumBins / Extent : 0.0f;
+		}
+
+		auto BinOf = [&](const FVector& Centroid, int Axis)
+		{
+			return min<uint32_t>(BVHNumBins - 1, static_cast<uint32_t>((GetAxis(Centroid, Axis) - Origin[Axis]) * Scale[Axis]));
+		};
+
+		FBin Bins[3][BVHNumBins];
+
+		auto BinRange = [&](size_t Begin, size_t End, FBin (&OutBins)[3][BVHNumBins])
+		{
+			for (size_t i = Begin; i < End; i++)
+			{
+				const uint32_t t = Context.Order[i];
+				const FVector& Centroid = Context.Centroids[t];
+
+				for (int a = 0; a < 3; a++)
+				{
+					FBin& Bin = OutBins[a][BinOf(Centroid, a)];
+					Bin.Bounds.Add(Context.TriangleBounds[t]);
+					Bin.CentroidBounds.Add(Centroid);
+					Bin.Count++;
+				}
+			}
+		};
+
+		// ū (  ܰ)   ķ   ħ (ġ    )
+		if (Range.Count >= MinElementsPerTask && Context.Pool.Num() > 1)
+		{
+			mutex MergeMutex;
+
+			ParallelForRanges(Context.Pool, Range.Count, MinElementsPerTask, [&](size_t Begin, size_t End)
+			{
+				FBin Local[3][BVHNumBins];
+				BinRange(Range.First + Begin, Range.First + End, Local);
+
+				lock_guard<mutex> Lock(MergeMutex);
+
+				for (int a = 0; a < 3; a++)
+				{
+					for (uint32_t b = 0; b < BVHNumBins; b++)
+					{
+						Bins[a][b].Bounds.Add(Local[a][b].Bounds);
+						Bins[a][b].CentroidBounds.Add(Local[a][b].CentroidBounds);
+						Bins[a][b].Count += Local[a][b].Count;
+					}
+				}
+			});
+		}
+		else
+		{
+			BinRange(Range.First, Range.First + Range.Count, Bins);
+		}
+
+		// ึ b°  ڿ ڸ   =   x  +   x 
+		int BestAxis = -1;
+		uint32_t BestBin = 0;
+		float BestCost = INFINITY;
+
+		for (int a = 0; a < 3; a++)
+		{
+			if (Scale[a] == 0.0f)
+			{
+				continue;
+			}
+
+			float RightCost[BVHNumBins];
+			FBox RightBox;
+			uint32_t RightCount = 0;
+
+			for (uint32_t b = BVHNumBins - 1; b > 0; b--)
+			{
+				RightBox.Add(Bins[a][b].Bounds);
+				RightCount += Bins[a][b].Count;
+				RightCost[b - 1] = RightBox.SurfaceArea() * RightCount;
+			}
+
+			FBox LeftBox;
+			uint32_t LeftCount = 0;
+
+			for (uint32_t b = 0; b + 1 < BVHNumBins; b++)
+			{
+				LeftBox.Add(Bins[a][b].Bounds);
+				LeftCount += Bins[a][b].Count;
+
+				if (LeftCount == 0 || LeftCount == Range.Count)
+				{
+					continue;
+				}
+
+				const float Cost = LeftBox.SurfaceArea() * LeftCount + RightCost[b];
+
+				if (Cost < BestCost)
+				{
+					BestCost = Cost;
+					BestAxis = a;
+					BestBin = b;
+				}
+			}
+		}
+
+		const float Area = Range.Bounds.SurfaceArea();
+		const float LeafCost = Area * Range.Count;
+		const float SplitCost = Area * BVHTraversalCost + BestCost;
+
+		if (Range.Count <= BVHMaxLeafTriangles && LeafCost <= SplitCost)
+		{
+			return false;
+		}
+
+		uint32_t* Begin = Context.Order.data() + Range.First;
+		uint32_t* End = Begin + Range.Count;
+		uint32_t* Middle = nullptr;
+
+		if (BestAxis >= 0)
+		{
+			Middle = partition(Begin, End, [&](uint32_t t) { return BinOf(Context.Centroids[t], BestAxis) <= BestBin; });
+		}
+		else
+		{
+			// ߽  Ƽ SAH     ݾ
+			Middle = Begin + Range.Count / 2;
+		}
+
+		OutLeft = FBuildRange();
+		OutRight = FBuildRange();
+		OutLeft.First = Range.First;
+		OutLeft.Count = static_cast<uint32_t>(Middle - Begin);
+		OutRight.First = Range.First + OutLeft.Count;
+		OutRight.Count = Range.Count - OutLeft.Count;
+
+		if (BestAxis >= 0)
+		{
+			for (uint32_t b = 0; b < BVHNumBins; b++)
+			{
+				FBuildRange& Side = (b <= BestBin) ? OutLeft : OutRight;
+				Side.Bounds.Add(Bins[BestAxis][b].Bounds);
+				Side.CentroidBounds.Add(Bins[BestAxis][b].CentroidBounds);
+			}
+		}
+		else
+		{
+			for (uint32_t* It = Begin; It != End; It++)
+			{
+				FBuildRange& Side = (It < Middle) ? OutLeft : OutRight;
+				Side.Bounds.Add(Context.TriangleBounds[*It]);
+				Side.CentroidBounds.Add(Context.Centroids[*It]);
+			}
+		}
+
+		return true;
+	}
+
+	// ־ ڽ ĺ(1~2)   ϳ ,  Ʈ OutNodes ڿ  켱 ߰.  ȣ ȯ
+	// ڽ 4     ڽ SAH 
+	static uint32_t BuildNode(FBuildContext& Context, const FBuildRange* InChildren, int NumInChildren, int Depth, vector<FBVHNode>& OutNodes)
+	{
+		FBuildRange Children[4];
+		bool bTested[4] = {};
+		bool bLeaf[4] = {};
+		int NumChildren = NumInChildren;
+
+		for (int c = 0; c < NumInChildren; c++)
+		{
+			Children[c] = InChildren[c];
+		}
+
+		const bool bMaxDepth = Depth + 1 >= BVHMaxDepth;
+
+		while (NumChildren < 4 && !bMaxDepth)
+		{
+			int Best = -1;
+			float BestArea = -1.0f;
+
+			for (int c = 0; c < NumChildren; c++)
+			{
+				if (!bTested[c] && Children[c].Bounds.SurfaceArea() > BestArea)
+				{
+					Best = c;
+					BestArea = Children[c].Bounds.SurfaceArea();
+				}
+			}
+
+			if (Best < 0)
+			{
+				break;
+			}
+
+			FBuildRange Left, Right;
+
+			if (SplitRange(Context, Children[Best], Left, Right))
+			{
+				Children[Best] = Left;
+				Children[NumChildren++] = Right;
+			}
+			else
+			{
+				bTested[Best] = bLeaf[Best] = true;
+			}
+		}
+
+		// ڽ  áµ     ڽ ⼭    ,     Ʒ 带 
+		FBuildRange Grandchildren[4][2];
+
+		for (int c = 0; c < NumChildren; c++)
+		{
+			if (!bTested[c])
+			{
+				bLeaf[c] = bMaxDepth || !SplitRange(Context, Children[c], Grandchildren[c][0], Grandchildren[c][1]);
+			}
+		}
+
+		const uint32_t NodeIndex = static_cast<uint32_t>(OutNodes.size());
+		OutNodes.emplace_back();
+
+		{
+			FBVHNode& Node = OutNodes[NodeIndex];
+
+			for (int c = 0; c < 4; c++)
+			{
+				const FBox Box = (c < NumChildren) ? Children[c].Bounds : FBox();
+				const float Values[6] = { Box.Min.x, Box.Min.y, Box.Min.z, Box.Max.x, Box.Max.y, Box.Max.z };
+
+				for (int k = 0; k < 6; k++)
+				{
+					Node.Bounds[k][c] = Values[k];
+				}
+
+				Node.Child[c] = (c < NumChildren) ? (bLeaf[c] ? Children[c].First : 0) : BVHEmptyChild;
+				Node.Count[c] = (c < NumChildren && bLeaf[c]) ? Children[c].Count : 0;
+			}
+		}
+
+		// ū Ʈ  ؼ ߿ ̰,   ٷ ̾ 
+		vector<future<vector<FBVHNode>>> Pending;
+		int PendingChild[4];
+
+		for (int c = 0; c < NumChildren; c++)
+		{
+			if (bLeaf[c])
+			{
+				continue;
+			}
+
+			const FBuildRange* Split = Grandchildren[c];
+
+			if (Children[c].Count >= MinElementsPerTask && Context.Pool.Num() > 1)
+			{
+				PendingChild[Pending.size()] = c;
+				Pending.push_back(Context.Pool.Submit([&Context, Split, Depth]()
+				{
+					vector<FBVHNode> SubNodes;
+					BuildNode(Context, Split, 2, Depth + 1, SubNodes);
+					return SubNodes;
+				}));
+			}
+			else
+			{
+				const uint32_t ChildIndex = BuildNode(Context, Split, 2, Depth + 1, OutNodes);
+				OutNodes[NodeIndex].Child[c] = ChildIndex;
+			}
+		}
+
+		for (size_t p = 0; p < Pending.size(); p++)
+		{
+			vector<FBVHNode> SubNodes = Context.Pool.Wait(Pending[p]);
+			const uint32_t Base = static_cast<uint32_t>(OutNodes.size());
+
+			// Ʈ    ȣ  ġŭ о  (leaf  ڽ ״)
+			for (FBVHNode& SubNode : SubNodes)
+			{
+				for (int c = 0; c < 4; c++)
+				{
+					SubNode.Child[c] += (SubNode.Count[c] == 0 && SubNode.Child[c] != BVHEmptyChild) ? Base : 0;
+				}
+			}
+
+			OutNodes.insert(OutNodes.end(), SubNodes.begin(), SubNodes.end());
+			OutNodes[NodeIndex].Child[PendingChild[p]] = Base;
+		}
+
+		return NodeIndex;
+	}
+
+	vector<FBVHNode> Nodes;
+	vector<FBVHTriangle> Triangles;
+	FBox Bounds;
+};
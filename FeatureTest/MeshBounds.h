@@ -0,0 +1,63 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+#include <vector>
+
+#include "Structs.h"
+#include "ThreadPool.h"
+#include "MeshNormals.h"
+
+//  ġ  ٿ ڽ   ( ߽ = ڽ ߽,  =    Ÿ)
+//     ġǷ ġ    
+inline void ComputeMeshBounds(UStaticMesh& InOutUStaticMesh, FThreadPool& Pool = FThreadPool::Get())
+{
+	const vector<Vertex>& Vertices = InOutUStaticMesh.Vertices;
+
+	FBox Bounds;
+	mutex MergeMutex;
+
+	ParallelForRanges(Pool, Vertices.size(), MinElementsPerTask, [&](size_t Begin, size_t End)
+	{
+		FBox Local;
+
+		for (size_t v = Begin; v < End; v++)
+		{
+			Local.Add(Vertices[v].Location);
+		}
+
+		lock_guard<mutex> Lock(MergeMutex);
+		Bounds.Add(Local);
+	});
+
+	InOutUStaticMesh.Bounds = Bounds;
+	InOutUStaticMesh.BoundingSphere = FSphere();
+
+	if (Bounds.IsEmpty())
+	{
+		return;
+	}
+
+	const FVector Center = Bounds.Center();
+	float MaxDistanceSquared = 0.0f;
+
+	ParallelForRanges(Pool, Vertices.size(), MinElementsPerTask, [&](size_t Begin, size_t End)
+	{
+		float Local = 0.0f;
+
+		for (size_t v = Begin; v < End; v++)
+		{
+			const FVector& P = Vertices[v].Location;
+			const FVector D(P.x - Center.x, P.y - Center.y, P.z - Center.z);
+
+			Local = max(Local, Dot(D, D));
+		}
+
+		lock_guard<mutex> Lock(MergeMutex);
+		MaxDistanceSquared = max(MaxDistanceSquared, Local);
+	});
+
+	InOutUStaticMesh.BoundingSphere.Center = Center;
+	InOutUStaticMesh.BoundingSphere.Radius = sqrtf(MaxDistanceSquared);
+}
@@ -0,0 +1,203 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "Structs.h"
+#include "FMatrix.h"
+#include "ThreadPool.h"
+#include "SimdFloat4.h"
+#include "MeshNormals.h"
+
+// - Ŀ  ü  6 (a, b, c, d). a*x + b*y + c*z + d >= 0̸  
+//   Ծ(Ŭ = VP * p, ̵  ), Ŭ    0 <= z <= w
+struct FFrustum
+{
+	float Planes[6][4];
+
+	static FFrustum FromViewProjection(const FMatrix& ViewProjection)
+	{
+		const float (&M)[4][4] = ViewProjection.M;
+		FFrustum Result;
+
+		for (int c = 0; c < 4; c++)
+		{
+			Result.Planes[0][c] = M[3][c] + M[0][c];	//    -w <= x
+			Result.Planes[1][c] = M[3][c] - M[0][c];	//   x <= w
+			Result.Planes[2][c] = M[3][c] + M[1][c];	// Ʒ   -w <= y
+			Result.Planes[3][c] = M[3][c] - M[1][c];	//       y <= w
+			Result.Planes[4][c] = M[2][c];				//   0 <= z
+			Result.Planes[5][c] = M[3][c] - M[2][c];	//       z <= w
+		}
+
+		return Result;
+	}
+};
+
+// νϽ (64 x ۾ ) ̸̸  . ܾ(64)   ۾  ܾ  
+constexpr size_t CullWordsPerTask = MinElementsPerTask / 64;
+
+//   θ    ( ٽ ġ ʵ ȣ   )
+struct FFrustumLanes
+{
+	FFloat4 Plane[6][4];
+	FFloat4 AbsNormal[6][3];
+
+	explicit FFrustumLanes(const FFrustum& Frustum)
+	{
+		for (int p = 0; p < 6; p++)
+		{
+			for (int c = 0; c < 4; c++)
+			{
+				Plane[p][c] = FFloat4::Splat(Frustum.Planes[p][c]);
+			}
+
+			for (int c = 0; c < 3; c++)
+			{
+				AbsNormal[p][c] = FFloat4::Splat(fabsf(Frustum.Planes[p][c]));
+			}
+		}
+	}
+};
+
+// ڽ 4(߽/ , θ ϳ)  6 ؼ ̴  Ʈ ũ ȯ
+// ڽ     ָ  (߽ + |n| )  ̸  
+inline int TestFrustumLanes(const FFrustumLanes& Frustum, const FFloat4 (&Center)[3], const FFloat4 (&Extent)[3])
+{
+	const FFloat4 Zero = FFloat4::Splat(0.0f);
+	int Outside = 0;
+
+	for (int p = 0; p < 6 && Outside != 0xF; p++)
+	{
+		const FFloat4 (&Plane)[4] = Frustum.Plane[p];
+		const FFloat4 (&AbsNormal)[3] = Frustum.AbsNormal[p];
+
+		const FFloat4 Distance = Center[0] * Plane[0] + Center[1] * Plane[1] + Center[2] * Plane[2] + Plane[3];
+		const FFloat4 Radius = Extent[0] * AbsNormal[0] + Extent[1] * AbsNormal[1] + Extent[2] * AbsNormal[2];
+
+		Outside |= MoveMask(LessThan(Distance + Radius, Zero));
+	}
+
+	return ~Outside & 0xF;
+}
+
+// νϽ 4      κ Ƽ  ڽ  AABB ȯ (Arvo:  ̴ |M| )
+inline void TransformBoxLanes(const FMatrix* const (&Matrices)[4], const FFloat4 (&LocalCenter)[3], const FFloat4 (&LocalExtent)[3], FFloat4 (&OutCenter)[3], FFloat4 (&OutExtent)[3])
+{
+	for (int r = 0; r < 3; r++)
+	{
+		//   r°  о ġϸ  c [νϽ 0..3] M[r][c]
+		FFloat4 C0 = FFloat4::Load(Matrices[0]->M[r]);
+		FFloat4 C1 = FFloat4::Load(Matrices[1]->M[r]);
+		FFloat4 C2 = FFloat4::Load(Matrices[2]->M[r]);
+		FFloat4 C3 = FFloat4::Load(Matrices[3]->M[r]);
+
+		Transpose4(C0, C1, C2, C3);
+
+		OutCenter[r] = C0 * LocalCenter[0] + C1 * LocalCenter[1] + C2 * LocalCenter[2] + C3;
+		OutExtent[r] = Abs(C0) * LocalExtent[0] + Abs(C1) * LocalExtent[1] + Abs(C2) * LocalExtent[2];
+	}
+}
+
+//  ޽(LocalBounds)  νϽ ü ø. OutVisible i° Ʈ = i° νϽ ̴
+// νϽ 4 SIMD ˻ϰ, νϽ  64  Ǯ  ó
+inline void CullInstances(const FBox& LocalBounds, const FMatrix* WorldMatrices, size_t NumInstances, const FMatrix& ViewProjection, vector<uint64_t>& OutVisible, FThreadPool& Pool = FThreadPool::Get())
+{
+	const size_t NumWords = (NumInstances + 63) / 64;
+
+	OutVisible.assign(NumWords, 0);
+
+	if (LocalBounds.IsEmpty())
+	{
+		return;
+	}
+
+	const FFrustumLanes Frustum(FFrustum::FromViewProjection(ViewProjection));
+	const FVector C = LocalBounds.Center();
+	const FVector E = LocalBounds.Extent();
+	const FFloat4 LocalCenter[3] = { FFloat4::Splat(C.x), FFloat4::Splat(C.y), FFloat4::Splat(C.z) };
+	const FFloat4 LocalExtent[3] = { FFloat4::Splat(E.x), FFloat4::Splat(E.y), FFloat4::Splat(E.z) };
+
+	ParallelForRanges(Pool, NumWords, CullWordsPerTask, [&](size_t BeginWord, size_t EndWord)
+	{
+		for (size_t w = BeginWord; w < EndWord; w++)
+		{
+			const size_t First = w * 64;
+			const size_t Last = min(NumInstances, First + 64);
+			uint64_t Bits = 0;
+
+			for (size_t i = First; i < Last; i += 4)
+			{
+				//   4  Ǹ    νϽ ä Ʈ 
+				const FMatrix* const Lanes[4] =
+				{
+					&WorldMatrices[i],
+					&WorldMatrices[min(i + 1, Last - 1)],
+					&WorldMatrices[min(i + 2, Last - 1)],
+					&WorldMatrices[min(i + 3, Last - 1)],
+				};
+
+				FFloat4 Center[3], Extent[3];
+				TransformBoxLanes(Lanes, LocalCenter, LocalExtent, Center, Extent);
+
+				const int LaneCount = static_cast<int>(min<size_t>(4, Last - i));
+				const uint64_t Visible = static_cast<uint64_t>(TestFrustumLanes(Frustum, Center, Extent) & ((1 << LaneCount) - 1));
+
+				Bits |= Visible << (i - First);
+			}
+
+			OutVisible[w] = Bits;
+		}
+	});
+}
+
+// ̹   ִ ڽ( ٸ ޽) ü ø.   CullInstances 
+inline void CullBoxes(const FBox* WorldBounds, size_t NumBoxes, const FMatrix& ViewProjection, vector<uint64_t>& OutVisible, FThreadPool& Pool = FThreadPool::Get())
+{
+	const size_t NumWords = (NumBoxes + 63) / 64;
+
+	OutVisible.assign(NumWords, 0);
+
+	const FFrustumLanes Frustum(FFrustum::FromViewProjection(ViewProjection));
+
+	ParallelForRanges(Pool, NumWords, CullWordsPerTask, [&](size_t BeginWord, size_t EndWord)
+	{
+		for (size_t w = BeginWord; w < EndWord; w++)
+		{
+			const size_t First = w * 64;
+			const size_t Last = min(NumBoxes, First + 64);
+			uint64_t Bits = 0;
+
+			for (size_t i = First; i < Last; i += 4)
+			{
+				float Values[6][4];
+				int LaneMask = 0;
+
+				for (int l = 0; l < 4; l++)
+				{
+					const FBox& Box = WorldBounds[min(i + l, Last - 1)];
+					const FVector C = Box.Center();
+					const FVector E = Box.Extent();
+
+					Values[0][l] = C.x; Values[1][l] = C.y; Values[2][l] = C.z;
+					Values[3][l] = E.x; Values[4][l] = E.y; Values[5][l] = E.z;
+					LaneMask |= (i + l < Last && !Box.IsEmpty()) ? (1 << l) : 0;
+				}
+
+				const FFloat4 Center[3] = { FFloat4::Load(Values[0]), FFloat4::Load(Values[1]), FFloat4::Load(Values[2]) };
+				const FFloat4 Extent[3] = { FFloat4::Load(Values[3]), FFloat4::Load(Values[4]), FFloat4::Load(Values[5]) };
+
+				Bits |= static_cast<uint64_t>(TestFrustumLanes(Frustum, Center, Extent) & LaneMask) << (i - First);
+			}
+
+			OutVisible[w] = Bits;
+		}
+	});
+}
+
+inline bool IsVisible(const vector<uint64_t>& Visible, size_t Index)
+{
+	return (Visible[Index / 64] >> (Index % 64)) & 1;
+}
@@ -0,0 +1,522 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "Structs.h"
+#include "ThreadPool.h"
+#include "SimdFloat4.h"
+#include "VertexDedupMap.h"
+
+struct FNormalOptions
+{
+	// ̿      ũ  ġ   (180̸  )
+	float SmoothingAngleDegrees = 180.0f;
+	//  ε  (  ߸)
+	bool bAngleWeighted = true;
+	//  (0, 0, 0) (OBJ vn  )  
+	bool bOnlyMissing = false;
+};
+
+// ۾ ϳ ô ּ ﰢ/  (ʹ ߰  ۾ ȯ   ŭ)
+constexpr size_t MinElementsPerTask = 16384;
+
+// ﰢ    ະ 迭    (SIMD Ŀ Է, [c][ﰢ])
+struct FTriangleSoA
+{
+	vector<float> X[3];
+	vector<float> Y[3];
+	vector<float> Z[3];
+
+	void Resize(size_t NumTriangles)
+	{
+		for (int c = 0; c < 3; c++)
+		{
+			X[c].resize(NumTriangles);
+			Y[c].resize(NumTriangles);
+			Z[c].resize(NumTriangles);
+		}
+	}
+};
+
+// ﰢ Ŀ   ([c][ﰢ]  )
+struct FTriangleFrames
+{
+	vector<float> NX, NY, NZ;	//  (GenerateNormals:  =  x 2, GenerateTangents:  źƮ )
+	vector<float> Sign;			// GenerateTangents: UV   ﰢ̸ -1
+	vector<float> Angle[3];		//   ()
+
+	void Resize(size_t NumTriangles, bool bWithSign)
+	{
+		NX.resize(NumTriangles);
+		NY.resize(NumTriangles);
+		NZ.resize(NumTriangles);
+		Sign.resize(bWithSign ? NumTriangles : 0);
+
+		for (int c = 0; c < 3; c++)
+		{
+			Angle[c].resize(NumTriangles);
+		}
+	}
+};
+
+// ̰ 0  Fallback ȯ
+inline FVector NormalizeOr(const FVector& V, const FVector& Fallback)
+{
+	const float LengthSquared = Dot(V, V);
+
+	if (LengthSquared <= 1e-30f)
+	{
+		return Fallback;
+	}
+
+	const float InvLength = 1.0f / sqrtf(LengthSquared);
+
+	return FVector(V.x * InvLength, V.y * InvLength, V.z * InvLength);
+}
+
+//  ϳ   "ִ "  (BuildStaticMesh vn  0 ä)
+inline bool IsMissingNormal(const FVector& N)
+{
+	return N.x == 0.0f && N.y == 0.0f && N.z == 0.0f;
+}
+
+// ġ     ȣ (UV     ġ  )
+inline size_t WeldPositions(const UStaticMesh& InUStaticMesh, vector<uint32_t>& OutPositionOf)
+{
+	// -0.0 0.0  Ű ǵ 0 ؼ Ʈ  
+	auto Bits = [](float Value)
+	{
+		Value += 0.0f;
+
+		int32_t Result;
+		memcpy(&Result, &Value, sizeof(Result));
+
+		return Result;
+	};
+
+	FVertexDedupMap PositionMap(InUStaticMesh.Vertices.size());
+	size_t NumPositions = 0;
+
+	OutPositionOf.resize(InUStaticMesh.Vertices.size());
+
+	for (size_t v = 0; v < InUStaticMesh.Vertices.size(); v++)
+	{
+		const FVector& P = InUStaticMesh.Vertices[v].Location;
+
+		bool bAdded = false;
+		OutPositionOf[v] = PositionMap.FindOrAdd(Bits(P.x), Bits(P.y), Bits(P.z), static_cast<int32_t>(NumPositions), bAdded);
+		NumPositions += bAdded ? 1 : 0;
+	}
+
+	return NumPositions;
+}
+
+// Ű(ġ ȣ/ ȣ)  Ű  ﰢ   (CSR)
+template<typename F>
+inline void BuildCornerLists(size_t NumCorners, size_t NumKeys, F&& KeyOfCorner, vector<uint32_t>& OutOffsets, vector<uint32_t>& OutCorners)
+{
+	OutOffsets.assign(NumKeys + 1, 0);
+	OutCorners.resize(NumCorners);
+
+	for (size_t c = 0; c < NumCorners; c++)
+	{
+		OutOffsets[KeyOfCorner(c) + 1]++;
+	}
+
+	for (size_t k = 0; k < NumKeys; k++)
+	{
+		OutOffsets[k + 1] += OutOffsets[k];
+	}
+
+	vector<uint32_t> Cursor(OutOffsets.begin(), OutOffsets.end() - 1);
+
+	for (size_t c = 0; c < NumCorners; c++)
+	{
+		OutCorners[Cursor[KeyOfCorner(c)]++] = static_cast<uint32_t>(c);
+	}
+}
+
+// ﰢ   ġ SoA  (ﰢ  )
+inline void GatherTrianglePositions(const UStaticMesh& InUStaticMesh, FTriangleSoA& OutPositions, FThreadPool& Pool)
+{
+	const size_t NumTriangles = InUStaticMesh.Indices.size() / 3;
+
+	OutPositions.Resize(NumTriangles);
+
+	ParallelForRanges(Pool, NumTriangles, MinElementsPerTask, [&](size_t Begin, size_t End)
+	{
+		for (size_t t = Begin; t < End; t++)
+		{
+			for (int c = 0; c < 3; c++)
+			{
+				const FVector& P = InUStaticMesh.Vertices[InUStaticMesh.Indices[t * 3 + c]].Location;
+
+				OutPositions.X[c][t] = P.x;
+				OutPositions.Y[c][t] = P.y;
+				OutPositions.Z[c][t] = P.z;
+			}
+		}
+	});
+}
+
+//   E1 = B - A, E2 = C - A  E3 = C - B     
+template<typename T>
+inline void ComputeCornerAngles(const T (&E1)[3], const T (&E2)[3], const T (&E3)[3], FTriangleFrames& Out, size_t i)
+{
+	const T Tiny = SplatLanes<T>(1e-30f);
+
+	const T L1 = E1[0] * E1[0] + E1[1] * E1[1] + E1[2] * E1[2];
+	const T L2 = E2[0] * E2[0] + E2[1] * E2[1] + E2[2] * E2[2];
+	const T L3 = E3[0] * E3[0] + E3[1] * E3[1] + E3[2] * E3[2];
+
+	const T D12 = E1[0] * E2[0] + E1[1] * E2[1] + E1[2] * E2[2];
+	const T D13 = E1[0] * E3[0] + E1[1] * E3[1] + E1[2] * E3[2];
+	const T D23 = E2[0] * E3[0] + E2[1] * E3[1] + E2[2] * E3[2];
+
+	// A: (B - A, C - A), B: (A - B, C - B), C: (A - C, B - C)
+	StoreLanes(&Out.Angle[0][i], FastAcos(D12 / Sqrt(Max(L1 * L2, Tiny))));
+	StoreLanes(&Out.Angle[1][i], FastAcos(-D13 / Sqrt(Max(L1 * L3, Tiny))));
+	StoreLanes(&Out.Angle[2][i], FastAcos(D23 / Sqrt(Max(L2 * L3, Tiny))));
+}
+
+//  (  ǵ ȭ ) 
+template<typename T>
+inline void ComputeFaceNormalLanes(const FTriangleSoA& P, FTriangleFrames& Out, size_t i)
+{
+	T E1[3], E2[3], E3[3];
+
+	const T Ax = LoadLanes<T>(&P.X[0][i]), Ay = LoadLanes<T>(&P.Y[0][i]), Az = LoadLanes<T>(&P.Z[0][i]);
+	const T Bx = LoadLanes<T>(&P.X[1][i]), By = LoadLanes<T>(&P.Y[1][i]), Bz = LoadLanes<T>(&P.Z[1][i]);
+	const T Cx = LoadLanes<T>(&P.X[2][i]), Cy = LoadLanes<T>(&P.Y[2][i]), Cz = LoadLanes<T>(&P.Z[2][i]);
+
+	E1[0] = Bx - Ax; E1[1] = By - Ay; E1[2] = Bz - Az;
+	E2[0] = Cx - Ax; E2[1] = Cy - Ay; E2[2] = Cz - Az;
+	E3[0] = Cx - Bx; E3[1] = Cy - By; E3[2] = Cz - Bz;
+
+	StoreLanes(&Out.NX[i], E1[1] * E2[2] - E1[2] * E2[1]);
+	StoreLanes(&Out.NY[i], E1[2] * E2[0] - E1[0] * E2[2]);
+	StoreLanes(&Out.NZ[i], E1[0] * E2[1] - E1[1] * E2[0]);
+
+	ComputeCornerAngles(E1, E2, E3, Out, i);
+}
+
+// MikkTSpace  Ģ: S = dV2 * E1 - dV1 * E2  ȭϰ, UV ȣ ̰   Sign = -1
+// UV ̰ 0 ﰢ S = 0 (źƮ ⿩ )
+template<typename T>
+inline void ComputeFaceTangentLanes(const FTriangleSoA& P, const FTriangleSoA& UV, FTriangleFrames& Out, size_t i)
+{
+	T E1[3], E2[3], E3[3];
+
+	const T Ax = LoadLanes<T>(&P.X[0][i]), Ay = LoadLanes<T>(&P.Y[0][i]), Az = LoadLanes<T>(&P.Z[0][i]);
+	const T Bx = LoadLanes<T>(&P.X[1][i]), By = LoadLanes<T>(&P.Y[1][i]), Bz = LoadLanes<T>(&P.Z[1][i]);
+	const T Cx = LoadLanes<T>(&P.X[2][i]), Cy = LoadLanes<T>(&P.Y[2][i]), Cz = LoadLanes<T>(&P.Z[2][i]);
+
+	E1[0] = Bx - Ax; E1[1] = By - Ay; E1[2] = Bz - Az;
+	E2[0] = Cx - Ax; E2[1] = Cy - Ay; E2[2] = Cz - Az;
+	E3[0] = Cx - Bx; E3[1] = Cy - By; E3[2] = Cz - Bz;
+
+	const T DU1 = LoadLanes<T>(&UV.X[1][i]) - LoadLanes<T>(&UV.X[0][i]);
+	const T DV1 = LoadLanes<T>(&UV.Y[1][i]) - LoadLanes<T>(&UV.Y[0][i]);
+	const T DU2 = LoadLanes<T>(&UV.X[2][i]) - LoadLanes<T>(&UV.X[0][i]);
+	const T DV2 = LoadLanes<T>(&UV.Y[2][i]) - LoadLanes<T>(&UV.Y[0][i]);
+
+	const T SignedArea = DU1 * DV2 - DV1 * DU2;
+
+	const T Sx = DV2 * E1[0] - DV1 * E2[0];
+	const T Sy = DV2 * E1[1] - DV1 * E2[1];
+	const T Sz = DV2 * E1[2] - DV1 * E2[2];
+
+	const T Zero = SplatLanes<T>(0.0f);
+	const T Sign = Select(LessThan(Zero, SignedArea), SplatLanes<T>(1.0f), SplatLanes<T>(-1.0f));
+	const T Length = Sqrt(Max(Sx * Sx + Sy * Sy + Sz * Sz, SplatLanes<T>(1e-30f)));
+	const T Scale = Select(LessThan(Abs(SignedArea), SplatLanes<T>(1e-20f)), Zero, Sign / Length);
+
+	StoreLanes(&Out.NX[i], Sx * Scale);
+	StoreLanes(&Out.NY[i], Sy * Scale);
+	StoreLanes(&Out.NZ[i], Sz * Scale);
+	StoreLanes(&Out.Sign[i], Sign);
+
+	ComputeCornerAngles(E1, E2, E3, Out, i);
+}
+
+// vn  ޽ÿ ε巯  
+//  ġ(UV    ) ϴ    x   
+// SmoothingAngleDegrees < 180̸    ȿ ִ 鸸 ϰ,  ٸ   
+//   ٲǷ  źƮ 
+inline void GenerateNormals(UStaticMesh& InOutUStaticMesh, const FNormalOptions& Options = FNormalOptions(), FThreadPool& Pool = FThreadPool::Get())
+{
+	vector<Vertex>& Vertices = InOutUStaticMesh.Vertices;
+	vector<int>& Indices = InOutUStaticMesh.Indices;
+
+	const size_t NumCorners = Indices.size() / 3 * 3;
+	const size_t NumTriangles = NumCorners / 3;
+	const FVector DefaultNormal(0.0f, 0.0f, 1.0f);
+
+	InOutUStaticMesh.Tangents.clear();
+
+	if (NumTriangles == 0)
+	{
+		return;
+	}
+
+	vector<uint32_t> PositionOf;
+	const size_t NumPositions = WeldPositions(InOutUStaticMesh, PositionOf);
+
+	FTriangleSoA Positions;
+	GatherTrianglePositions(InOutUStaticMesh, Positions, Pool);
+
+	FTriangleFrames Faces;
+	Faces.Resize(NumTriangles, false);
+
+	ParallelForRanges(Pool, NumTriangles, MinElementsPerTask, [&](size_t Begin, size_t End)
+	{
+		ForEachLanes(Begin, End, [&](size_t i, auto Lanes)
+		{
+			ComputeFaceNormalLanes<decltype(Lanes)>(Positions, Faces, i);
+		});
+	});
+
+	vector<uint32_t> PositionOffsets;
+	vector<uint32_t> PositionCorners;
+
+	BuildCornerLists(NumCorners, NumPositions, [&](size_t c) { return PositionOf[Indices[c]]; }, PositionOffsets, PositionCorners);
+
+	auto WeightedFaceNormal = [&](uint32_t c)
+	{
+		const size_t t = c / 3;
+		const float Weight = Options.bAngleWeighted ? Faces.Angle[c % 3][t] : 1.0f;
+
+		return FVector(Faces.NX[t] * Weight, Faces.NY[t] * Weight, Faces.NZ[t] * Weight);
+	};
+
+	auto NeedsNormal = [&](size_t v)
+	{
+		return !Options.bOnlyMissing || IsMissingNormal(Vertices[v].Normal);
+	};
+
+	if (Options.SmoothingAngleDegrees >= 180.0f)
+	{
+		// ġ  ϳ
+		vector<FVector> PositionNormals(NumPositions);
+
+		ParallelForRanges(Pool, NumPositions, MinElementsPerTask, [&](size_t Begin, size_t End)
+		{
+			for (size_t p = Begin; p < End; p++)
+			{
+				FVector Sum;
+
+				for (uint32_t a = PositionOffsets[p]; a < PositionOffsets[p + 1]; a++)
+				{
+					const FVector N = WeightedFaceNormal(PositionCorners[a]);
+					Sum = FVector(Sum.x + N.x, Sum.y + N.y, Sum.z + N.z);
+				}
+
+				PositionNormals[p] = NormalizeOr(Sum, DefaultNormal);
+			}
+		});
+
+		ParallelForRanges(Pool, Vertices.size(), MinElementsPerTask, [&](size_t Begin, size_t End)
+		{
+			for (size_t v = Begin; v < End; v++)
+			{
+				if (NeedsNormal(v))
+				{
+					Vertices[v].Normal = PositionNormals[PositionOf[v]];
+				}
+			}
+		});
+
+		return;
+	}
+
+	//  ڱ    ȿ ִ ̿ 鸸 
+	const float CosThreshold = cosf(Options.SmoothingAngleDegrees * 3.14159265f / 180.0f);
+	vector<FVector> CornerNormals(NumCorners);
+
+	ParallelForRanges(Pool, NumPositions, MinElementsPerTask, [&](size_t Begin, size_t End)
+	{
+		vector<FVector> UnitFaceNormals;
+
+		for (size_t p = Begin; p < End; p++)
+		{
+			const uint32_t First = PositionOffsets[p];
+			const uint32_t Last = PositionOffsets[p + 1];
+
+			UnitFaceNormals.clear();
+
+			for (uint32_t a = First; a < Last; a++)
+			{
+				const size_t t = PositionCorners[a] / 3;
+				UnitFaceNormals.push_back(NormalizeOr(FVector(Faces.NX[t], Faces.NY[t], Faces.NZ[t]), FVector()));
+			}
+
+			for (uint32_t a = First; a < Last; a++)
+			{
+				FVector Sum;
+				FVector All;
+
+				for (uint32_t b = First; b < Last; b++)
+				{
+					const FVector N = WeightedFaceNormal(PositionCorners[b]);
+
+					All = FVector(All.x + N.x, All.y + N.y, All.z + N.z);
+
+					if (Dot(UnitFaceNormals[a - First], UnitFaceNormals[b - First]) >= CosThreshold)
+					{
+						Sum = FVector(Sum.x + N.x, Sum.y + N.y, Sum.z + N.z);
+					}
+				}
+
+				// ȭ ﰢ  ġ ü  
+				CornerNormals[PositionCorners[a]] = NormalizeOr(Sum, NormalizeOr(All, DefaultNormal));
+			}
+		}
+	});
+
+	//  ϳ  ٸ  ϸ   ϳ 
+	//      Ʈ Ƿ Ȯ 
+	vector<uint32_t> VertexOffsets;
+	vector<uint32_t> VertexCorners;
+
+	const size_t NumVertices = Vertices.size();
+
+	BuildCornerLists(NumCorners, NumVertices, [&](size_t c) { return static_cast<uint32_t>(Indices[c]); }, VertexOffsets, VertexCorners);
+
+	vector<pair<FVector, int>> Seen;
+
+	for (size_t v = 0; v < NumVertices; v++)
+	{
+		if (!NeedsNormal(v))
+		{
+			continue;
+		}
+
+		Seen.clear();
+
+		for (uint32_t a = VertexOffsets[v]; a < VertexOffsets[v + 1]; a++)
+		{
+			const uint32_t c = VertexCorners[a];
+			const FVector& N = CornerNormals[c];
+			int Index = -1;
+
+			for (const pair<FVector, int>& Entry : Seen)
+			{
+				if (Entry.first.x == N.x && Entry.first.y == N.y && Entry.first.z == N.z)
+				{
+					Index = Entry.second;
+					break;
+				}
+			}
+
+			if (Index < 0)
+			{
+				if (Seen.empty())
+				{
+					Index = static_cast<int>(v);
+					Vertices[v].Normal = N;
+				}
+				else
+				{
+					Vertex Split = Vertices[v];
+					Split.Normal = N;
+
+					Index = static_cast<int>(Vertices.size());
+					Vertices.push_back(Split);
+				}
+
+				Seen.push_back({ N, Index });
+			}
+
+			Indices[c] = Index;
+		}
+	}
+}
+
+// UV  źƮ   (  ־ )
+// MikkTSpaceó  źƮ   鿡 ؼ   ϰ Gram-Schmidt ȭ
+// UV (̷)  ׷     ϸ MikkTSpace   ⼭ ġ ū  ȣ 
+inline void GenerateTangents(UStaticMesh& InOutUStaticMesh, FThreadPool& Pool = FThreadPool::Get())
+{
+	const vector<Vertex>& Vertices = InOutUStaticMesh.Vertices;
+	const vector<int>& Indices = InOutUStaticMesh.Indices;
+
+	const size_t NumCorners = Indices.size() / 3 * 3;
+	const size_t NumTriangles = NumCorners / 3;
+
+	FTriangleSoA Positions;
+	FTriangleSoA TexCoords;
+
+	GatherTrianglePositions(InOutUStaticMesh, Positions, Pool);
+
+	for (int c = 0; c < 3; c++)
+	{
+		TexCoords.X[c].resize(NumTriangles);
+		TexCoords.Y[c].resize(NumTriangles);
+	}
+
+	ParallelForRanges(Pool, NumTriangles, MinElementsPerTask, [&](size_t Begin, size_t End)
+	{
+		for (size_t t = Begin; t < End; t++)
+		{
+			for (int c = 0; c < 3; c++)
+			{
+				const FVector2& UV = Vertices[Indices[t * 3 + c]].TexCoord;
+
+				TexCoords.X[c][t] = UV.u;
+				TexCoords.Y[c][t] = UV.v;
+			}
+		}
+	});
+
+	FTriangleFrames Faces;
+	Faces.Resize(NumTriangles, true);
+
+	ParallelForRanges(Pool, NumTriangles, MinElementsPerTask, [&](size_t Begin, size_t End)
+	{
+		ForEachLanes(Begin, End, [&](size_t i, auto Lanes)
+		{
+			ComputeFaceTangentLanes<decltype(Lanes)>(Positions, TexCoords, Faces, i);
+		});
+	});
+
+	vector<uint32_t> VertexOffsets;
+	vector<uint32_t> VertexCorners;
+
+	BuildCornerLists(NumCorners, Vertices.size(), [&](size_t c) { return static_cast<uint32_t>(Indices[c]); }, VertexOffsets, VertexCorners);
+
+	InOutUStaticMesh.Tangents.resize(Vertices.size());
+
+	ParallelForRanges(Pool, Vertices.size(), MinElementsPerTask, [&](size_t Begin, size_t End)
+	{
+		for (size_t v = Begin; v < End; v++)
+		{
+			const FVector N = NormalizeOr(Vertices[v].Normal, FVector(0.0f, 0.0f, 1.0f));
+
+			FVector Sum;
+			float SignSum = 0.0f;
+
+			for (uint32_t a = VertexOffsets[v]; a < VertexOffsets[v + 1]; a++)
+			{
+				const uint32_t c = VertexCorners[a];
+				const size_t t = c / 3;
+				const FVector S(Faces.NX[t], Faces.NY[t], Faces.NZ[t]);
+				const float Projection = Dot(N, S);
+				const FVector Projected = NormalizeOr(FVector(S.x - N.x * Projection, S.y - N.y * Projection, S.z - N.z * Projection), FVector());
+				const float Weight = Faces.Angle[c % 3][t];
+
+				Sum = FVector(Sum.x + Projected.x * Weight, Sum.y + Projected.y * Weight, Sum.z + Projected.z * Weight);
+				SignSum += Faces.Sign[t] * Weight;
+			}
+
+			// UV ȭؼ     ƹ 
+			const FVector Axis = (fabsf(N.x) < 0.9f) ? FVector(1.0f, 0.0f, 0.0f) : FVector(0.0f, 1.0f, 0.0f);
+			const float Projection = Dot(N, Sum);
+
+			FTangent& Tangent = InOutUStaticMesh.Tangents[v];
+			Tangent.Direction = NormalizeOr(FVector(Sum.x - N.x * Projection, Sum.y - N.y * Projection, Sum.z - N.z * Projection), NormalizeOr(Cross(N, Axis), Axis));
+			Tangent.BitangentSign = (SignSum < 0.0f) ? -1.0f : 1.0f;
+		}
+	});
+}
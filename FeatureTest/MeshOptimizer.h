@@ -0,0 +1,275 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+#include "Structs.h"
+
+//  ĳ ȿ ǥ
+// ACMR: ﰢ ĳ ̽  (ּ  0.5, ־ 3.0)
+// ATVR:  ȯ Ƚ (ּ 1.0)
+struct FVertexCacheStats
+{
+	float ACMR = 0.0f;
+	float ATVR = 0.0f;
+};
+
+struct FMeshOptimizeStats
+{
+	FVertexCacheStats Before;
+	FVertexCacheStats After;
+	double VertexCacheSeconds = 0.0;
+	double VertexFetchSeconds = 0.0;
+};
+
+// Ϲ GPU ó ĳ ũ
+constexpr int DefaultVertexCacheSize = 16;
+
+// FIFO ĳø 䳻 ACMR/ATVR 
+inline FVertexCacheStats ComputeVertexCacheStats(const vector<int>& Indices, size_t NumVertices, int CacheSize = DefaultVertexCacheSize)
+{
+	FVertexCacheStats Stats;
+
+	if (Indices.empty() || NumVertices == 0)
+	{
+		return Stats;
+	}
+
+	//  ĳÿ   (Time - CachedAt < CacheSize ̸  ĳÿ )
+	vector<int64_t> CachedAt(NumVertices, -static_cast<int64_t>(CacheSize) - 1);
+	int64_t Time = 0;
+	size_t Misses = 0;
+
+	for (int Index : Indices)
+	{
+		if (Time - CachedAt[Index] >= CacheSize)
+		{
+			CachedAt[Index] = Time++;
+			Misses++;
+		}
+	}
+
+	Stats.ACMR = static_cast<float>(Misses) / static_cast<float>(Indices.size() / 3);
+	Stats.ATVR = static_cast<float>(Misses) / static_cast<float>(NumVertices);
+
+	return Stats;
+}
+
+// Tipsify (Sander et al. 2007): ĳÿ  ִ  ֺ ﰢ ä÷ ʴ   ð 
+// ﰢ   (ε) ״ 
+inline void OptimizeVertexCache(vector<int>& Indices, size_t NumVertices, int CacheSize = DefaultVertexCacheSize)
+{
+	const size_t NumTriangles = Indices.size() / 3;
+
+	if (NumTriangles == 0 || NumVertices == 0)
+	{
+		return;
+	}
+
+	//  ->  ﰢ  (CSR)
+	vector<uint32_t> AdjacencyOffsets(NumVertices + 1, 0);
+
+	for (int Index : Indices)
+	{
+		AdjacencyOffsets[Index + 1]++;
+	}
+
+	for (size_t v = 0; v < NumVertices; v++)
+	{
+		AdjacencyOffsets[v + 1] += AdjacencyOffsets[v];
+	}
+
+	vector<uint32_t> Adjacency(Indices.size());
+	vector<uint32_t> LiveTriangles(NumVertices);
+
+	{
+		vector<uint32_t> Cursor(AdjacencyOffsets.begin(), AdjacencyOffsets.end() - 1);
+
+		for (size_t t = 0; t < NumTriangles; t++)
+		{
+			for (int c = 0; c < 3; c++)
+			{
+				const int v = Indices[t * 3 + c];
+				Adjacency[Cursor[v]++] = static_cast<uint32_t>(t);
+			}
+		}
+	}
+
+	for (size_t v = 0; v < NumVertices; v++)
+	{
+		LiveTriangles[v] = AdjacencyOffsets[v + 1] - AdjacencyOffsets[v];
+	}
+
+	vector<int64_t> CacheTime(NumVertices, 0);
+	vector<bool> bEmitted(NumTriangles, false);
+	vector<int> DeadEndStack;
+	vector<int> Candidates;
+	vector<int> Result;
+
+	Result.reserve(Indices.size());
+	DeadEndStack.reserve(Indices.size());
+
+	int64_t Time = CacheSize + 1;
+	size_t ScanCursor = 0;
+	int Fanning = Indices[0];
+
+	while (Fanning >= 0)
+	{
+		Candidates.clear();
+
+		for (uint32_t a = AdjacencyOffsets[Fanning]; a < AdjacencyOffsets[Fanning + 1]; a++)
+		{
+			const uint32_t t = Adjacency[a];
+
+			if (bEmitted[t])
+			{
+				continue;
+			}
+
+			for (int c = 0; c < 3; c++)
+			{
+				const int v = Indices[t * 3 + c];
+
+				Result.push_back(v);
+				DeadEndStack.push_back(v);
+				Candidates.push_back(v);
+				LiveTriangles[v]--;
+
+				if (Time - CacheTime[v] > CacheSize)
+				{
+					CacheTime[v] = Time++;
+				}
+			}
+
+			bEmitted[t] = true;
+		}
+
+		//  ä ߽:  ﰢ   ĳÿ   ĺ    
+		int Best = -1;
+		int64_t BestPriority = -1;
+
+		for (int v : Candidates)
+		{
+			if (LiveTriangles[v] == 0)
+			{
+				continue;
+			}
+
+			int64_t Priority = 0;
+
+			if (Time - CacheTime[v] + 2 * static_cast<int64_t>(LiveTriangles[v]) <= CacheSize)
+			{
+				Priority = Time - CacheTime[v];
+			}
+
+			if (Priority > BestPriority)
+			{
+				BestPriority = Priority;
+				Best = v;
+			}
+		}
+
+		// ٸ ̸ ֱٿ  , װ͵  Է   
+		while (Best < 0 && !DeadEndStack.empty())
+		{
+			const int v = DeadEndStack.back();
+			DeadEndStack.pop_back();
+
+			if (LiveTriangles[v] > 0)
+			{
+				Best = v;
+			}
+		}
+
+		while (Best < 0 && ScanCursor < NumVertices)
+		{
+			if (LiveTriangles[ScanCursor] > 0)
+			{
+				Best = static_cast<int>(ScanCursor);
+			}
+
+			ScanCursor++;
+		}
+
+		Fanning = Best;
+	}
+
+	Indices.swap(Result);
+}
+
+// ε ۿ ó ̴   ٽ ġؼ  fetch  
+//  ﰢ  ʴ  ŵ
+inline void OptimizeVertexFetch(UStaticMesh& InOutUStaticMesh)
+{
+	vector<int> Remap(InOutUStaticMesh.Vertices.size(), -1);
+	vector<Vertex> NewVertices;
+	vector<FTangent> NewTangents;
+
+	const bool bHasTangents = !InOutUStaticMesh.Tangents.empty();
+
+	NewVertices.reserve(InOutUStaticMesh.Vertices.size());
+	NewTangents.reserve(InOutUStaticMesh.Tangents.size());
+
+	for (int& Index : InOutUStaticMesh.Indices)
+	{
+		if (Remap[Index] < 0)
+		{
+			Remap[Index] = static_cast<int>(NewVertices.size());
+			NewVertices.push_back(InOutUStaticMesh.Vertices[Index]);
+
+			if (bHasTangents)
+			{
+				NewTangents.push_back(InOutUStaticMesh.Tangents[Index]);
+			}
+		}
+
+		Index = Remap[Index];
+	}
+
+	InOutUStaticMesh.Vertices.swap(NewVertices);
+	InOutUStaticMesh.Tangents.swap(NewTangents);
+}
+
+// BuildStaticMesh ڿ ̴  ܰ: ĳ  -> fetch ġ (  ״ )
+inline void OptimizeStaticMesh(UStaticMesh& InOutUStaticMesh, FMeshOptimizeStats* OutStats = nullptr)
+{
+	using Clock = chrono::steady_clock;
+
+	FMeshOptimizeStats Stats;
+	Stats.Before = ComputeVertexCacheStats(InOutUStaticMesh.Indices, InOutUStaticMesh.Vertices.size());
+
+	auto CacheStart = Clock::now();
+
+	//   踦 Ѿ ﰢ ̸  ǹǷ      
+	if (InOutUStaticMesh.Sections.size() <= 1)
+	{
+		OptimizeVertexCache(InOutUStaticMesh.Indices, InOutUStaticMesh.Vertices.size());
+	}
+	else
+	{
+		vector<int> SectionIndices;
+
+		for (const FStaticMeshSection& Section : InOutUStaticMesh.Sections)
+		{
+			auto SectionBegin = InOutUStaticMesh.Indices.begin() + Section.FirstIndex;
+
+			SectionIndices.assign(SectionBegin, SectionBegin + Section.NumIndices);
+			OptimizeVertexCache(SectionIndices, InOutUStaticMesh.Vertices.size());
+			copy(SectionIndices.begin(), SectionIndices.end(), SectionBegin);
+		}
+	}
+
+	Stats.VertexCacheSeconds = chrono::duration<double>(Clock::now() - CacheStart).count();
+
+	auto FetchStart = Clock::now();
+	OptimizeVertexFetch(InOutUStaticMesh);
+	Stats.VertexFetchSeconds = chrono::duration<double>(Clock::now() - FetchStart).count();
+
+	Stats.After = ComputeVertexCacheStats(InOutUStaticMesh.Indices, InOutUStaticMesh.Vertices.size());
+
+	if (OutStats)
+	{
+		*OutStats = Stats;
+	}
+}
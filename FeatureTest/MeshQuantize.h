@@ -0,0 +1,444 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "Structs.h"
+#include "MeshBounds.h"
+
+//   (16Ʈ, Vertex )
+// ġ: ޽ AABB  16Ʈ unorm, UV: half float, : 8ü(octahedral) ڵ 16Ʈ snorm
+struct FCompactVertex
+{
+	uint16_t Position[3];
+	uint16_t TexCoord[2];
+	int16_t Normal[2];
+	uint16_t Padding;
+};
+
+static_assert(sizeof(FCompactVertex) == 16, "FCompactVertex 16Ʈ ؾ ");
+
+// 16Ʈ ε : Indices16[FirstIndex, FirstIndex + NumIndices) BaseVertex ϸ  ȣ (ο base vertex)
+struct FCompactIndexRange
+{
+	uint32_t FirstIndex;
+	uint32_t NumIndices;
+	uint32_t BaseVertex;
+};
+
+struct UCompactStaticMesh
+{
+	FVector BoundsMin;
+	FVector BoundsMax;
+
+	vector<FCompactVertex> Vertices;
+
+	// ﰢ  ϴ   65536 ̸ ǵ   16Ʈ ε +  BaseVertex
+	// ﰢ ϳ 65536 ̻   մ 쿡 ü 32Ʈ ε (  ϳ ä)
+	vector<uint16_t> Indices16;
+	vector<FCompactIndexRange> IndexRanges;
+	vector<uint32_t> Indices32;
+
+	// ε  ٲ Ƿ    ״  ( IndexRanges ġ κи ο ϳ)
+	vector<FStaticMeshSection> Sections;
+
+	bool Uses16BitIndices() const
+	{
+		return !Indices16.empty() || Indices32.empty();
+	}
+
+	size_t NumIndices() const
+	{
+		return Uses16BitIndices() ? Indices16.size() : Indices32.size();
+	}
+
+	uint32_t GetIndex(size_t i) const
+	{
+		if (!Uses16BitIndices())
+		{
+			return Indices32[i];
+		}
+
+		// i ϴ  (FirstIndex )
+		auto It = std::upper_bound(IndexRanges.begin(), IndexRanges.end(), i, [](size_t Index, const FCompactIndexRange& Range) { return Index < Range.FirstIndex; });
+
+		return (It - 1)->BaseVertex + Indices16[i];
+	}
+
+	size_t GetDataSize() const
+	{
+		return Vertices.size() * sizeof(FCompactVertex) + Indices16.size() * sizeof(uint16_t) + IndexRanges.size() * sizeof(FCompactIndexRange) + Indices32.size() * sizeof(uint32_t);
+	}
+};
+
+// ڵ  (MeasureCompactMeshError )
+struct FCompactMeshError
+{
+	float MaxPositionError = 0.0f;		// ະ   ִ
+	float MaxTexCoordError = 0.0f;		//   ִ
+	float MaxNormalAngle = 0.0f;		// 
+};
+
+// float -> half (  ¦ ݿø,   inf)
+inline uint16_t FloatToHalf(float Value)
+{
+	uint32_t Bits;
+	memcpy(&Bits, &Value, sizeof(Bits));
+
+	const uint32_t Sign = (Bits >> 16) & 0x8000;
+	const uint32_t RawExponent = (Bits >> 23) & 0xFF;
+	uint32_t Mantissa = Bits & 0x7FFFFF;
+
+	if (RawExponent == 0xFF)
+	{
+		return static_cast<uint16_t>(Sign | 0x7C00 | (Mantissa ? 0x200 : 0));
+	}
+
+	const int32_t Exponent = static_cast<int32_t>(RawExponent) - 127 + 15;
+
+	if (Exponent >= 31)
+	{
+		return static_cast<uint16_t>(Sign | 0x7C00);
+	}
+
+	if (Exponent <= 0)
+	{
+		// half Լ
+		if (Exponent < -10)
+		{
+			return static_cast<uint16_t>(Sign);
+		}
+
+		Mantissa |= 0x800000;
+
+		const uint32_t Shift = static_cast<uint32_t>(14 - Exponent);
+		uint32_t Half = Mantissa >> Shift;
+		const uint32_t Remainder = Mantissa & ((1u << Shift) - 1);
+		const uint32_t HalfWay = 1u << (Shift - 1);
+
+		if (Remainder > HalfWay || (Remainder == HalfWay && (Half & 1)))
+		{
+			Half++;
+		}
+
+		return static_cast<uint16_t>(Sign | Half);
+	}
+
+	uint32_t Half = Sign | (static_cast<uint32_t>(Exponent) << 10) | (Mantissa >> 13);
+	const uint32_t Remainder = Mantissa & 0x1FFF;
+
+	// ø ΰ ġ η ڿ ö
+	if (Remainder > 0x1000 || (Remainder == 0x1000 && (Half & 1)))
+	{
+		Half++;
+	}
+
+	return static_cast<uint16_t>(Half);
+}
+
+inline float HalfToFloat(uint16_t Half)
+{
+	const uint32_t Sign = static_cast<uint32_t>(Half & 0x8000) << 16;
+	const uint32_t Exponent = (Half >> 10) & 0x1F;
+	uint32_t Mantissa = Half & 0x3FF;
+	uint32_t Bits;
+
+	if (Exponent == 0)
+	{
+		if (Mantissa == 0)
+		{
+			Bits = Sign;
+		}
+		else
+		{
+			// Լ -> ȭ
+			int32_t e = -1;
+
+			do
+			{
+				e++;
+				Mantissa <<= 1;
+			} while ((Mantissa & 0x400) == 0);
+
+			Bits = Sign | (static_cast<uint32_t>(127 - 15 - e) << 23) | ((Mantissa & 0x3FF) << 13);
+		}
+	}
+	else if (Exponent == 31)
+	{
+		Bits = Sign | 0x7F800000 | (Mantissa << 13);
+	}
+	else
+	{
+		Bits = Sign | ((Exponent + 127 - 15) << 23) | (Mantissa << 13);
+	}
+
+	float Value;
+	memcpy(&Value, &Bits, sizeof(Value));
+
+	return Value;
+}
+
+inline int16_t QuantizeSnorm16(float Value)
+{
+	return static_cast<int16_t>(lroundf(std::clamp(Value, -1.0f, 1.0f) * 32767.0f));
+}
+
+//  ͸ 8ü   ļ 2 
+inline void EncodeOctahedral(const FVector& Normal, int16_t (&OutEncoded)[2])
+{
+	const float L1 = fabsf(Normal.x) + fabsf(Normal.y) + fabsf(Normal.z);
+
+	if (L1 == 0.0f)
+	{
+		OutEncoded[0] = 0;
+		OutEncoded[1] = 0;
+		return;
+	}
+
+	float x = Normal.x / L1;
+	float y = Normal.y / L1;
+
+	if (Normal.z < 0.0f)
+	{
+		const float FoldedX = (1.0f - fabsf(y)) * (x >= 0.0f ? 1.0f : -1.0f);
+		const float FoldedY = (1.0f - fabsf(x)) * (y >= 0.0f ? 1.0f : -1.0f);
+
+		x = FoldedX;
+		y = FoldedY;
+	}
+
+	OutEncoded[0] = QuantizeSnorm16(x);
+	OutEncoded[1] = QuantizeSnorm16(y);
+}
+
+inline FVector DecodeOctahedral(const int16_t (&Encoded)[2])
+{
+	float x = std::max(Encoded[0] / 32767.0f, -1.0f);
+	float y = std::max(Encoded[1] / 32767.0f, -1.0f);
+	const float z = 1.0f - fabsf(x) - fabsf(y);
+	const float t = std::max(-z, 0.0f);
+
+	x += (x >= 0.0f) ? -t : t;
+	y += (y >= 0.0f) ? -t : t;
+
+	const float Length = sqrtf(x * x + y * y + z * z);
+
+	return FVector(x / Length, y / Length, z / Length);
+}
+
+// ﰢ  ٰ  ϴ  (ּ~ִ) 65536 Ѱ Ǹ   
+//  ó   ȣ پ (BuildStaticMesh,  fetch ȭ)    65536 ϳ
+// ﰢ ϳ   false ( )
+inline bool EncodeIndexRanges16(const vector<int>& Indices, vector<uint16_t>& OutIndices, vector<FCompactIndexRange>& OutRanges)
+{
+	OutIndices.clear();
+	OutRanges.clear();
+
+	uint32_t RangeMin = UINT32_MAX;
+	uint32_t RangeMax = 0;
+
+	for (size_t t = 0; t < Indices.size(); t += 3)
+	{
+		const size_t End = std::min(Indices.size(), t + 3);
+		uint32_t TriangleMin = UINT32_MAX;
+		uint32_t TriangleMax = 0;
+
+		for (size_t i = t; i < End; i++)
+		{
+			TriangleMin = std::min(TriangleMin, static_cast<uint32_t>(Indices[i]));
+			TriangleMax = std::max(TriangleMax, static_cast<uint32_t>(Indices[i]));
+		}
+
+		if (TriangleMax - TriangleMin > 65535)
+		{
+			OutRanges.clear();
+			return false;
+		}
+
+		const uint32_t NewMin = std::min(RangeMin, TriangleMin);
+		const uint32_t NewMax = std::max(RangeMax, TriangleMax);
+
+		if (OutRanges.empty() || NewMax - NewMin > 65535)
+		{
+			OutRanges.push_back({ static_cast<uint32_t>(t), 0, 0 });
+			RangeMin = TriangleMin;
+			RangeMax = TriangleMax;
+		}
+		else
+		{
+			RangeMin = NewMin;
+			RangeMax = NewMax;
+		}
+
+		OutRanges.back().NumIndices += static_cast<uint32_t>(End - t);
+		OutRanges.back().BaseVertex = RangeMin;
+	}
+
+	OutIndices.resize(Indices.size());
+
+	for (const FCompactIndexRange& Range : OutRanges)
+	{
+		for (uint32_t i = Range.FirstIndex; i < Range.FirstIndex + Range.NumIndices; i++)
+		{
+			OutIndices[i] = static_cast<uint16_t>(static_cast<uint32_t>(Indices[i]) - Range.BaseVertex);
+		}
+	}
+
+	return true;
+}
+
+inline void EncodeCompactMesh(const UStaticMesh& InUStaticMesh, UCompactStaticMesh& OutCompactMesh)
+{
+	OutCompactMesh = UCompactStaticMesh();
+
+	if (InUStaticMesh.Vertices.empty())
+	{
+		return;
+	}
+
+	FVector Min = InUStaticMesh.Vertices[0].Location;
+	FVector Max = Min;
+
+	for (const Vertex& v : InUStaticMesh.Vertices)
+	{
+		Min = FVector(std::min(Min.x, v.Location.x), std::min(Min.y, v.Location.y), std::min(Min.z, v.Location.z));
+		Max = FVector(std::max(Max.x, v.Location.x), std::max(Max.y, v.Location.y), std::max(Max.z, v.Location.z));
+	}
+
+	OutCompactMesh.BoundsMin = Min;
+	OutCompactMesh.BoundsMax = Max;
+
+	const float BoundsMin[3] = { Min.x, Min.y, Min.z };
+	const float Extent[3] = { Max.x - Min.x, Max.y - Min.y, Max.z - Min.z };
+	float Scale[3];
+
+	for (int a = 0; a < 3; a++)
+	{
+		Scale[a] = (Extent[a] > 0.0f) ? 65535.0f / Extent[a] : 0.0f;
+	}
+
+	OutCompactMesh.Vertices.resize(InUStaticMesh.Vertices.size());
+
+	for (size_t i = 0; i < InUStaticMesh.Vertices.size(); i++)
+	{
+		const Vertex& Source = InUStaticMesh.Vertices[i];
+		FCompactVertex& Target = OutCompactMesh.Vertices[i];
+		const float Location[3] = { Source.Location.x, Source.Location.y, Source.Location.z };
+
+		for (int a = 0; a < 3; a++)
+		{
+			Target.Position[a] = static_cast<uint16_t>(std::min(65535L, lroundf((Location[a] - BoundsMin[a]) * Scale[a])));
+		}
+
+		Target.TexCoord[0] = FloatToHalf(Source.TexCoord.u);
+		Target.TexCoord[1] = FloatToHalf(Source.TexCoord.v);
+		EncodeOctahedral(Source.Normal, Target.Normal);
+		Target.Padding = 0;
+	}
+
+	if (!EncodeIndexRanges16(InUStaticMesh.Indices, OutCompactMesh.Indices16, OutCompactMesh.IndexRanges))
+	{
+		OutCompactMesh.Indices32.assign(InUStaticMesh.Indices.begin(), InUStaticMesh.Indices.end());
+	}
+
+	OutCompactMesh.Sections = InUStaticMesh.Sections;
+}
+
+inline Vertex DecodeCompactVertex(const UCompactStaticMesh& InCompactMesh, const FCompactVertex& Source)
+{
+	const FVector& Min = InCompactMesh.BoundsMin;
+	const FVector& Max = InCompactMesh.BoundsMax;
+
+	Vertex Result;
+
+	Result.Location = FVector(
+		Min.x + Source.Position[0] * ((Max.x - Min.x) / 65535.0f),
+		Min.y + Source.Position[1] * ((Max.y - Min.y) / 65535.0f),
+		Min.z + Source.Position[2] * ((Max.z - Min.z) / 65535.0f));
+	Result.TexCoord = { HalfToFloat(Source.TexCoord[0]), HalfToFloat(Source.TexCoord[1]) };
+	Result.Normal = DecodeOctahedral(Source.Normal);
+
+	return Result;
+}
+
+inline void DecodeCompactMesh(const UCompactStaticMesh& InCompactMesh, UStaticMesh& OutUStaticMesh)
+{
+	OutUStaticMesh.Vertices.resize(InCompactMesh.Vertices.size());
+	OutUStaticMesh.Indices.resize(InCompactMesh.NumIndices());
+
+	for (size_t i = 0; i < InCompactMesh.Vertices.size(); i++)
+	{
+		OutUStaticMesh.Vertices[i] = DecodeCompactVertex(InCompactMesh, InCompactMesh.Vertices[i]);
+	}
+
+	if (InCompactMesh.Uses16BitIndices())
+	{
+		for (const FCompactIndexRange& Range : InCompactMesh.IndexRanges)
+		{
+			for (uint32_t i = Range.FirstIndex; i < Range.FirstIndex + Range.NumIndices; i++)
+			{
+				OutUStaticMesh.Indices[i] = static_cast<int>(Range.BaseVertex + InCompactMesh.Indices16[i]);
+			}
+		}
+	}
+	else
+	{
+		for (size_t i = 0; i < OutUStaticMesh.Indices.size(); i++)
+		{
+			OutUStaticMesh.Indices[i] = static_cast<int>(InCompactMesh.Indices32[i]);
+		}
+	}
+
+	OutUStaticMesh.Sections = InCompactMesh.Sections;
+	OutUStaticMesh.Tangents.clear();
+
+	ComputeMeshBounds(OutUStaticMesh);
+}
+
+//  ڵ  ؼ    ( 0  )
+inline FCompactMeshError MeasureCompactMeshError(const UStaticMesh& Original, const UCompactStaticMesh& InCompactMesh)
+{
+	FCompactMeshError Error;
+
+	for (size_t i = 0; i < Original.Vertices.size(); i++)
+	{
+		const Vertex& a = Original.Vertices[i];
+		const Vertex b = DecodeCompactVertex(InCompactMesh, InCompactMesh.Vertices[i]);
+
+		Error.MaxPositionError = std::max({ Error.MaxPositionError, fabsf(a.Location.x - b.Location.x), fabsf(a.Location.y - b.Location.y), fabsf(a.Location.z - b.Location.z) });
+		Error.MaxTexCoordError = std::max({ Error.MaxTexCoordError, fabsf(a.TexCoord.u - b.TexCoord.u), fabsf(a.TexCoord.v - b.TexCoord.v) });
+
+		const float Length = sqrtf(a.Normal.x * a.Normal.x + a.Normal.y * a.Normal.y + a.Normal.z * a.Normal.z);
+
+		if (Length > 0.0f)
+		{
+			const float Dot = (a.Normal.x * b.Normal.x + a.Normal.y * b.Normal.y + a.Normal.z * b.Normal.z) / Length;
+
+			Error.MaxNormalAngle = std::max(Error.MaxNormalAngle, acosf(std::clamp(Dot, -1.0f, 1.0f)));
+		}
+	}
+
+	return Error;
+}
+
+// ̷  
+// ġ: ȭ   (+ float   ), UV: half   2^-11 (|uv| <= 1 , Լ  2^-25 )
+// : 16Ʈ 8ü ڵ ִ    0.04 (   200  ),  ΰ 0.05
+inline FCompactMeshError GetCompactMeshErrorBounds(const UCompactStaticMesh& InCompactMesh, float MaxAbsTexCoord = 1.0f)
+{
+	const FVector& Min = InCompactMesh.BoundsMin;
+	const FVector& Max = InCompactMesh.BoundsMax;
+	const float MaxExtent = std::max({ Max.x - Min.x, Max.y - Min.y, Max.z - Min.z });
+	const float MaxAbsBound = std::max({ fabsf(Min.x), fabsf(Min.y), fabsf(Min.z), fabsf(Max.x), fabsf(Max.y), fabsf(Max.z) });
+
+	FCompactMeshError Bounds;
+
+	Bounds.MaxPositionError = MaxExtent * (0.5f / 65535.0f) + MaxAbsBound * 4.0f * 1.1920929e-7f;
+	Bounds.MaxTexCoordError = std::max(MaxAbsTexCoord, 6.1035156e-5f) * (1.0f / 2048.0f);
+	Bounds.MaxNormalAngle = 0.05f * 3.14159265f / 180.0f;
+
+	return Bounds;
+}
@@ -0,0 +1,665 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "Structs.h"
+#include "ThreadPool.h"
+#include "MeshNormals.h"
+#include "MeshOptimizer.h"
+
+// LOD ϳ.  ۴  UStaticMesh ״  ε ۸  
+struct FStaticMeshLOD
+{
+	vector<int> Indices;
+	vector<FStaticMeshSection> Sections;
+	float TargetRatio = 1.0f;		// û ﰢ 
+	float Error = 0.0f;				//  ǥ Ÿ  ġ ( , ̹ LOD  collapse  ִ)
+	float RelativeError = 0.0f;		// Error / ٿ ڽ 밢 
+};
+
+// / 𼭸 ϵ ϴ  quadric ġ ( quadric )
+constexpr double SimplifyEdgeWeight = 10.0;
+
+// Ī 4x4  [A b; b^T c]  ݰ ġ  (   Ÿ    )
+struct FQuadric
+{
+	double a00 = 0, a01 = 0, a02 = 0, a11 = 0, a12 = 0, a22 = 0;
+	double b0 = 0, b1 = 0, b2 = 0;
+	double c = 0;
+	double Weight = 0;
+
+	//  n.x + d = 0  Ÿ  Weight  quadric
+	static FQuadric FromPlane(double nx, double ny, double nz, double d, double InWeight)
+	{
+		FQuadric Q;
+
+		Q.a00 = InWeight * nx * nx; Q.a01 = InWeight * nx * ny; Q.a02 = InWeight * nx * nz;
+		Q.a11 = InWeight * ny * ny; Q.a12 = InWeight * ny * nz; Q.a22 = InWeight * nz * nz;
+		Q.b0 = InWeight * nx * d; Q.b1 = InWeight * ny * d; Q.b2 = InWeight * nz * d;
+		Q.c = InWeight * d * d;
+		Q.Weight = InWeight;
+
+		return Q;
+	}
+
+	FQuadric& operator+=(const FQuadric& R)
+	{
+		a00 += R.a00; a01 += R.a01; a02 += R.a02; a11 += R.a11; a12 += R.a12; a22 += R.a22;
+		b0 += R.b0; b1 += R.b1; b2 += R.b2;
+		c += R.c;
+		Weight += R.Weight;
+
+		return *this;
+	}
+
+	//   Ÿ 
+	double Error(const FVector& P) const
+	{
+		const double x = P.x, y = P.y, z = P.z;
+		const double Sum = a00 * x * x + a11 * y * y + a22 * z * z + 2.0 * (a01 * x * y + a02 * x * z + a12 * y * z)
+			+ 2.0 * (b0 * x + b1 * y + b2 * z) + c;
+
+		return Weight > 0.0 ? max(0.0, Sum / Weight) : 0.0;
+	}
+};
+
+// ġ :      collapse  ִ 
+enum class ESimplifyVertexKind : uint8_t
+{
+	Manifold,	//  . ε collapse 
+	Border,		//   .  𼭸 󼭸
+	Seam,		// UV//  .  𼭸 󼭸
+	Locked,		// /  , پü .  
+};
+
+// quadric   edge collapse û ﰢ  LOD ε ۸  (  ó)
+//    ʴ half-edge collapse  LOD   ۸ 
+//  ġ ( ) Բ collapseϰ, /   󼭸 پ
+//   н  ġ ʴ collapse  ϹǷ   𼭸  ķ ó
+inline void GenerateLODChain(const UStaticMesh& InUStaticMesh, vector<float> TriangleRatios, vector<FStaticMeshLOD>& OutLODs, FThreadPool& Pool = FThreadPool::Get())
+{
+	OutLODs.clear();
+	sort(TriangleRatios.begin(), TriangleRatios.end(), greater<float>());
+
+	const vector<Vertex>& Vertices = InUStaticMesh.Vertices;
+	const size_t NumTriangles = InUStaticMesh.Indices.size() / 3;
+
+	if (NumTriangles == 0 || TriangleRatios.empty())
+	{
+		return;
+	}
+
+	vector<int> Indices(InUStaticMesh.Indices.begin(), InUStaticMesh.Indices.begin() + NumTriangles * 3);
+
+	// ﰢ    ȣ (ص  )
+	vector<uint32_t> TriangleSections(NumTriangles, 0);
+
+	for (size_t s = 0; s < InUStaticMesh.Sections.size(); s++)
+	{
+		const FStaticMeshSection& Section = InUStaticMesh.Sections[s];
+
+		for (uint32_t t = Section.FirstIndex / 3; t < (Section.FirstIndex + Section.NumIndices) / 3 && t < NumTriangles; t++)
+		{
+			TriangleSections[t] = static_cast<uint32_t>(s);
+		}
+	}
+
+	vector<uint32_t> PositionOf;
+	const size_t NumPositions = WeldPositions(InUStaticMesh, PositionOf);
+
+	vector<FVector> Positions(NumPositions);
+
+	for (size_t v = 0; v < Vertices.size(); v++)
+	{
+		Positions[PositionOf[v]] = Vertices[v].Location;
+	}
+
+	FVector BoundsMin = Positions[0];
+	FVector BoundsMax = Positions[0];
+
+	for (const FVector& P : Positions)
+	{
+		BoundsMin = FVector(min(BoundsMin.x, P.x), min(BoundsMin.y, P.y), min(BoundsMin.z, P.z));
+		BoundsMax = FVector(max(BoundsMax.x, P.x), max(BoundsMax.y, P.y), max(BoundsMax.z, P.z));
+	}
+
+	const FVector Extent(BoundsMax.x - BoundsMin.x, BoundsMax.y - BoundsMin.y, BoundsMax.z - BoundsMin.z);
+	const float Diagonal = max(1e-12f, sqrtf(Dot(Extent, Extent)));
+
+	// ġ ->  ġ  ﰢ (CSR, н ٽ )
+	vector<uint32_t> TriangleOffsets;
+	vector<uint32_t> TriangleList;
+
+	auto BuildAdjacency = [&]()
+	{
+		const size_t Count = Indices.size() / 3;
+
+		TriangleOffsets.assign(NumPositions + 1, 0);
+		TriangleList.resize(Indices.size());
+
+		for (int Index : Indices)
+		{
+			TriangleOffsets[PositionOf[Index] + 1]++;
+		}
+
+		for (size_t p = 0; p < NumPositions; p++)
+		{
+			TriangleOffsets[p + 1] += TriangleOffsets[p];
+		}
+
+		vector<uint32_t> Cursor(TriangleOffsets.begin(), TriangleOffsets.end() - 1);
+
+		for (size_t t = 0; t < Count; t++)
+		{
+			for (int c = 0; c < 3; c++)
+			{
+				TriangleList[Cursor[PositionOf[Indices[t * 3 + c]]]++] = static_cast<uint32_t>(t);
+			}
+		}
+	};
+
+	// Src-Dst 𼭸 ϴ ﰢ  (1 = , 2 = ,  ̻ پü)  
+	struct FEdgeInfo
+	{
+		int NumTriangles = 0;
+		bool bSeam = false;
+	};
+
+	auto GetEdgeInfo = [&](uint32_t Src, uint32_t Dst)
+	{
+		FEdgeInfo Info;
+		int SrcWedge = -1, DstWedge = -1;
+		uint32_t Section = 0;
+
+		for (uint32_t a = TriangleOffsets[Src]; a < TriangleOffsets[Src + 1]; a++)
+		{
+			const uint32_t t = TriangleList[a];
+			int Ws = -1, Wd = -1;
+
+			for (int c = 0; c < 3; c++)
+			{
+				const int w = Indices[t * 3 + c];
+				Ws = (PositionOf[w] == Src) ? w : Ws;
+				Wd = (PositionOf[w] == Dst) ? w : Wd;
+			}
+
+			if (Wd < 0)
+			{
+				continue;
+			}
+
+			if (Info.NumTriangles > 0 && (Ws != SrcWedge || Wd != DstWedge || TriangleSections[t] != Section))
+			{
+				Info.bSeam = true;
+			}
+
+			SrcWedge = Ws;
+			DstWedge = Wd;
+			Section = TriangleSections[t];
+			Info.NumTriangles++;
+		}
+
+		return Info;
+	};
+
+	BuildAdjacency();
+
+	// ġ  з:  𼭸  /  𼭸  Ǵ (  ̸  2)
+	vector<ESimplifyVertexKind> Kinds(NumPositions, ESimplifyVertexKind::Manifold);
+	vector<FQuadric> Quadrics(NumPositions);
+
+	{
+		vector<uint8_t> BorderEdges(NumPositions, 0);
+		vector<uint8_t> SeamEdges(NumPositions, 0);
+		vector<uint8_t> bComplex(NumPositions, 0);
+
+		for (size_t t = 0; t < NumTriangles; t++)
+		{
+			const FVector& A = Positions[PositionOf[Indices[t * 3 + 0]]];
+			const FVector& B = Positions[PositionOf[Indices[t * 3 + 1]]];
+			const FVector& C = Positions[PositionOf[Indices[t * 3 + 2]]];
+
+			const FVector FaceCross = Cross(FVector(B.x - A.x, B.y - A.y, B.z - A.z), FVector(C.x - A.x, C.y - A.y, C.z - A.z));
+			const float Area = 0.5f * sqrtf(Dot(FaceCross, FaceCross));
+			const FVector FaceNormal = NormalizeOr(FaceCross, FVector());
+
+			const FQuadric FaceQuadric = FQuadric::FromPlane(FaceNormal.x, FaceNormal.y, FaceNormal.z, -Dot(FaceNormal, A), Area);
+
+			for (int c = 0; c < 3; c++)
+			{
+				const uint32_t Src = PositionOf[Indices[t * 3 + c]];
+				const uint32_t Dst = PositionOf[Indices[t * 3 + (c + 1) % 3]];
+
+				Quadrics[Src] += FaceQuadric;
+
+				const FEdgeInfo Info = GetEdgeInfo(Src, Dst);
+
+				if (Info.NumTriangles > 2)
+				{
+					bComplex[Src] = bComplex[Dst] = 1;
+					continue;
+				}
+
+				if (Info.NumTriangles == 2 && !Info.bSeam)
+				{
+					continue;
+				}
+
+				//   ,   ﰢ   Ƿ  ݾ 
+				const double Share = (Info.NumTriangles == 1) ? 1.0 : 0.5;
+				const FVector& P0 = Positions[Src];
+				const FVector& P1 = Positions[Dst];
+				const FVector Edge(P1.x - P0.x, P1.y - P0.y, P1.z - P0.z);
+				const FVector EdgeNormal = NormalizeOr(Cross(Edge, FaceNormal), FVector());
+				const FQuadric EdgeQuadric = FQuadric::FromPlane(EdgeNormal.x, EdgeNormal.y, EdgeNormal.z, -Dot(EdgeNormal, P0), Share * SimplifyEdgeWeight * Dot(Edge, Edge));
+
+				Quadrics[Src] += EdgeQuadric;
+				Quadrics[Dst] += EdgeQuadric;
+
+				uint8_t* Counter = (Info.NumTriangles == 1) ? BorderEdges.data() : SeamEdges.data();
+				Counter[Src] = static_cast<uint8_t>(min(255, Counter[Src] + 1));
+				Counter[Dst] = static_cast<uint8_t>(min(255, Counter[Dst] + 1));
+			}
+		}
+
+		for (size_t p = 0; p < NumPositions; p++)
+		{
+			//  𼭸  ,  𼭸 ʿ   
+			const bool bBorder = BorderEdges[p] == 2;
+			const bool bSeam = SeamEdges[p] == 4;
+
+			if (bComplex[p] || (BorderEdges[p] != 0 && !bBorder) || (SeamEdges[p] != 0 && !bSeam) || (bBorder && bSeam))
+			{
+				Kinds[p] = ESimplifyVertexKind::Locked;
+			}
+			else if (bBorder)
+			{
+				Kinds[p] = ESimplifyVertexKind::Border;
+			}
+			else if (bSeam)
+			{
+				Kinds[p] = ESimplifyVertexKind::Seam;
+			}
+		}
+	}
+
+	struct FCollapse
+	{
+		uint32_t Src;
+		uint32_t Dst;
+		float Cost;
+	};
+
+	// 𼭸   ϹǷ 𼭸   ؼ  ⿡  
+	auto CanCollapse = [&](uint32_t Src, const FEdgeInfo& Info)
+	{
+		const ESimplifyVertexKind Kind = Kinds[Src];
+
+		if (Kind == ESimplifyVertexKind::Locked)
+		{
+			return false;
+		}
+
+		if (Info.NumTriangles == 0 || Info.NumTriangles > 2)
+		{
+			return false;
+		}
+
+		if (Kind == ESimplifyVertexKind::Border)
+		{
+			return Info.NumTriangles == 1;
+		}
+
+		if (Kind == ESimplifyVertexKind::Seam)
+		{
+			return Info.NumTriangles == 2 && Info.bSeam;
+		}
+
+		return true;
+	};
+
+	vector<int> WedgeRemap(Vertices.size());
+	vector<uint8_t> bLocked(NumPositions);
+	vector<uint8_t> bChanged(NumPositions, 1);	//  н ų(Src) quadric ٲ(Dst) ġ. ù н 
+	vector<uint32_t> ChangedPositions(NumPositions);
+	vector<pair<int, int>> WedgeMap;
+	vector<uint64_t> Edges;
+	vector<FCollapse> Candidates;
+	vector<FCollapse> NewCandidates;
+
+	for (size_t v = 0; v < Vertices.size(); v++)
+	{
+		WedgeRemap[v] = static_cast<int>(v);
+	}
+
+	for (uint32_t p = 0; p < NumPositions; p++)
+	{
+		ChangedPositions[p] = p;
+	}
+
+	float MaxError = 0.0f;
+	size_t RatioIndex = 0;
+
+	auto EmitLOD = [&](float Ratio)
+	{
+		FStaticMeshLOD LOD;
+		LOD.TargetRatio = Ratio;
+		LOD.Indices = Indices;
+		LOD.Error = sqrtf(MaxError);
+		LOD.RelativeError = LOD.Error / Diagonal;
+
+		// Ƴ ﰢ  ״̹Ƿ    ٽ 
+		const size_t CurrentTriangles = Indices.size() / 3;
+		size_t t = 0;
+
+		for (size_t s = 0; s < max<size_t>(1, InUStaticMesh.Sections.size()); s++)
+		{
+			const size_t First = t;
+
+			while (t < CurrentTriangles && TriangleSections[t] == s)
+			{
+				t++;
+			}
+
+			const FName Material = InUStaticMesh.Sections.empty() ? FName() : InUStaticMesh.Sections[s].Material;
+			LOD.Sections.push_back({ Material, static_cast<uint32_t>(First * 3), static_cast<uint32_t>((t - First) * 3) });
+		}
+
+		OutLODs.push_back(move(LOD));
+	};
+
+	while (RatioIndex < TriangleRatios.size())
+	{
+		const size_t CurrentTriangles = Indices.size() / 3;
+		const size_t TargetTriangles = static_cast<size_t>(TriangleRatios[RatioIndex] * NumTriangles);
+
+		if (CurrentTriangles <= TargetTriangles)
+		{
+			EmitLOD(TriangleRatios[RatioIndex++]);
+			continue;
+		}
+
+		// 1.  н ٲ ġ  𼭸 ٽ  (ġ ȣ , ߺ )
+		//    Src -> Dst collapse  Src 𼭸 Dst Ű ,    ״ 𼭸 quadric
+		//      Բ  ﰢ / ״ζ   ΰ ٲ 
+		Candidates.erase(remove_if(Candidates.begin(), Candidates.end(), [&](const FCollapse& C) { return bChanged[C.Src] || bChanged[C.Dst]; }), Candidates.end());
+		Edges.clear();
+
+		for (uint32_t p : ChangedPositions)
+		{
+			const size_t First = Edges.size();
+
+			for (uint32_t a = TriangleOffsets[p]; a < TriangleOffsets[p + 1]; a++)
+			{
+				for (int c = 0; c < 3; c++)
+				{
+					const uint32_t q = PositionOf[Indices[TriangleList[a] * 3 + c]];
+
+					//    ٲ ġ ȣ  ʿ . ̿    ǹǷ ߺ  Ž Ÿ
+					if (q == p || (bChanged[q] && q < p))
+					{
+						continue;
+					}
+
+					const uint64_t Edge = (static_cast<uint64_t>(min(p, q)) << 32) | max(p, q);
+
+					if (find(Edges.begin() + First, Edges.end(), Edge) == Edges.end())
+					{
+						Edges.push_back(Edge);
+					}
+				}
+			}
+		}
+
+		for (uint32_t p : ChangedPositions)
+		{
+			bChanged[p] = 0;
+		}
+
+		ChangedPositions.clear();
+
+		// 2.   𼭸       ()
+		NewCandidates.resize(Edges.size());
+
+		ParallelForRanges(Pool, Edges.size(), MinElementsPerTask, [&](size_t Begin, size_t End)
+		{
+			for (size_t e = Begin; e < End; e++)
+			{
+				const uint32_t P0 = static_cast<uint32_t>(Edges[e] >> 32);
+				const uint32_t P1 = static_cast<uint32_t>(Edges[e] & 0xFFFFFFFFu);
+
+				const FEdgeInfo Info = GetEdgeInfo(P0, P1);
+				FCollapse Best = { P0, P1, INFINITY };
+
+				for (int Direction = 0; Direction < 2; Direction++)
+				{
+					const uint32_t Src = Direction ? P1 : P0;
+					const uint32_t Dst = Direction ? P0 : P1;
+
+					if (!CanCollapse(Src, Info))
+					{
+						continue;
+					}
+
+					FQuadric Q = Quadrics[Src];
+					Q += Quadrics[Dst];
+
+					const float Cost = static_cast<float>(Q.Error(Positions[Dst]));
+
+					if (Cost < Best.Cost)
+					{
+						Best = { Src, Dst, Cost };
+					}
+				}
+
+				NewCandidates[e] = Best;
+			}
+		});
+
+		for (const FCollapse& Candidate : NewCandidates)
+		{
+			if (Candidate.Cost != INFINITY)
+			{
+				Candidates.push_back(Candidate);
+			}
+		}
+
+		if (Candidates.empty())
+		{
+			break;
+		}
+
+		// collapse ϳ  ﰢ 2 ֹǷ ʿ  1.5   ̹ н  
+		// ü  ʰ   ã    պκи 
+		auto CostLess = [](const FCollapse& A, const FCollapse& B) { return A.Cost < B.Cost; };
+
+		const size_t TrianglesToRemove = CurrentTriangles - TargetTriangles;
+		const size_t LimitIndex = min(Candidates.size() - 1, TrianglesToRemove / 2);
+
+		nth_element(Candidates.begin(), Candidates.begin() + LimitIndex, Candidates.end(), CostLess);
+
+		const float CostLimit = Candidates[LimitIndex].Cost * 1.5f + 1e-30f;
+		const auto Selected = partition(Candidates.begin() + LimitIndex, Candidates.end(), [CostLimit](const FCollapse& C) { return C.Cost <= CostLimit; });
+
+		sort(Candidates.begin(), Selected, CostLess);
+
+		// 3.    ġ ʴ collapse  (Src 1-ring ü ̹ н  )
+		fill(bLocked.begin(), bLocked.end(), 0);
+
+		size_t Removed = 0;
+
+		for (auto It = Candidates.begin(); It != Selected && Removed < TrianglesToRemove; ++It)
+		{
+			const FCollapse& Collapse = *It;
+			const uint32_t Src = Collapse.Src;
+			const uint32_t Dst = Collapse.Dst;
+
+			if (bLocked[Src] || bLocked[Dst])
+			{
+				continue;
+			}
+
+			// Src  (  )  ﰢ ִ Dst  Ŵ
+			WedgeMap.clear();
+
+			bool bValid = true;
+			size_t CollapsedTriangles = 0;
+
+			for (uint32_t a = TriangleOffsets[Src]; a < TriangleOffsets[Src + 1] && bValid; a++)
+			{
+				const uint32_t t = TriangleList[a];
+				int Ws = -1, Wd = -1;
+
+				for (int c = 0; c < 3; c++)
+				{
+					const int w = Indices[t * 3 + c];
+					Ws = (PositionOf[w] == Src) ? w : Ws;
+					Wd = (PositionOf[w] == Dst) ? w : Wd;
+				}
+
+				if (Wd < 0)
+				{
+					continue;
+				}
+
+				CollapsedTriangles++;
+
+				auto It = find_if(WedgeMap.begin(), WedgeMap.end(), [Ws](const pair<int, int>& Entry) { return Entry.first == Ws; });
+
+				if (It == WedgeMap.end())
+				{
+					WedgeMap.push_back({ Ws, Wd });
+				}
+				else if (It->second != Wd)
+				{
+					bValid = false;
+				}
+			}
+
+			// Dst  ﰢ  Src  ų, ű   ﰢ  
+			for (uint32_t a = TriangleOffsets[Src]; a < TriangleOffsets[Src + 1] && bValid; a++)
+			{
+				const uint32_t t = TriangleList[a];
+				int Corner = -1;
+				bool bHasDst = false;
+
+				for (int c = 0; c < 3; c++)
+				{
+					const uint32_t p = PositionOf[Indices[t * 3 + c]];
+					Corner = (p == Src) ? c : Corner;
+					bHasDst = bHasDst || p == Dst;
+				}
+
+				if (bHasDst)
+				{
+					continue;
+				}
+
+				const int Ws = Indices[t * 3 + Corner];
+
+				if (find_if(WedgeMap.begin(), WedgeMap.end(), [Ws](const pair<int, int>& Entry) { return Entry.first == Ws; }) == WedgeMap.end())
+				{
+					bValid = false;
+					break;
+				}
+
+				const FVector& P0 = Positions[PositionOf[Indices[t * 3 + (Corner + 1) % 3]]];
+				const FVector& P1 = Positions[PositionOf[Indices[t * 3 + (Corner + 2) % 3]]];
+				const FVector& Before = Positions[Src];
+				const FVector& After = Positions[Dst];
+
+				const FVector E0(P1.x - P0.x, P1.y - P0.y, P1.z - P0.z);
+				const FVector NormalBefore = Cross(E0, FVector(Before.x - P0.x, Before.y - P0.y, Before.z - P0.z));
+				const FVector NormalAfter = Cross(E0, FVector(After.x - P0.x, After.y - P0.y, After.z - P0.z));
+
+				bValid = Dot(NormalBefore, NormalAfter) > 0.0f;
+			}
+
+			if (!bValid)
+			{
+				continue;
+			}
+
+			for (const pair<int, int>& Entry : WedgeMap)
+			{
+				WedgeRemap[Entry.first] = Entry.second;
+			}
+
+			Quadrics[Dst] += Quadrics[Src];
+			MaxError = max(MaxError, Collapse.Cost);
+			Removed += CollapsedTriangles;
+
+			bChanged[Src] = bChanged[Dst] = 1;
+			ChangedPositions.push_back(Src);
+			ChangedPositions.push_back(Dst);
+
+			bLocked[Src] = bLocked[Dst] = 1;
+
+			for (uint32_t a = TriangleOffsets[Src]; a < TriangleOffsets[Src + 1]; a++)
+			{
+				const uint32_t t = TriangleList[a];
+
+				for (int c = 0; c < 3; c++)
+				{
+					bLocked[PositionOf[Indices[t * 3 + c]]] = 1;
+				}
+			}
+		}
+
+		if (Removed == 0)
+		{
+			break;
+		}
+
+		// 4. ε ű ȭ ﰢ  (ﰢ/   )
+		size_t Write = 0;
+
+		for (size_t t = 0; t < CurrentTriangles; t++)
+		{
+			const int A = WedgeRemap[Indices[t * 3 + 0]];
+			const int B = WedgeRemap[Indices[t * 3 + 1]];
+			const int C = WedgeRemap[Indices[t * 3 + 2]];
+
+			if (PositionOf[A] == PositionOf[B] || PositionOf[B] == PositionOf[C] || PositionOf[A] == PositionOf[C])
+			{
+				continue;
+			}
+
+			Indices[Write * 3 + 0] = A;
+			Indices[Write * 3 + 1] = B;
+			Indices[Write * 3 + 2] = C;
+			TriangleSections[Write] = TriangleSections[t];
+			Write++;
+		}
+
+		Indices.resize(Write * 3);
+		TriangleSections.resize(Write);
+
+		BuildAdjacency();
+	}
+
+	//          ä
+	while (RatioIndex < TriangleRatios.size())
+	{
+		EmitLOD(TriangleRatios[RatioIndex++]);
+	}
+
+	// LOD   ĳ  (LOD ̹Ƿ )
+	ParallelFor(Pool, OutLODs.size(), [&](size_t l)
+	{
+		FStaticMeshLOD& LOD = OutLODs[l];
+		vector<int> SectionIndices;
+
+		for (const FStaticMeshSection& Section : LOD.Sections)
+		{
+			auto SectionBegin = LOD.Indices.begin() + Section.FirstIndex;
+
+			SectionIndices.assign(SectionBegin, SectionBegin + Section.NumIndices);
+			OptimizeVertexCache(SectionIndices, Vertices.size());
+			copy(SectionIndices.begin(), SectionIndices.end(), SectionBegin);
+		}
+	});
+}
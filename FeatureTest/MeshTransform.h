@@ -0,0 +1,281 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include "Structs.h"
+#include "FMatrix.h"
+#include "ThreadPool.h"
+#include "SimdFloat4.h"
+#include "MeshNormals.h"
+#include "MeshBounds.h"
+
+//  16Ʈ   о 4 ġϴ Ŀ ϴ ġ
+// [x y z u][v nx ny nz] (Location, TexCoord, Normal  ƴ  32Ʈ)
+static_assert(offsetof(Vertex, TexCoord) == 12 && offsetof(Vertex, Normal) == 20 && sizeof(Vertex) == 32, "Vertex ̾ƿ   TransformVertices Ŀε  ");
+
+//     Ҹ  ü    (ȣ   )
+struct FMatrixLanes
+{
+	FFloat4 M[3][4];
+
+	explicit FMatrixLanes(const FMatrix& Matrix)
+	{
+		for (int r = 0; r < 3; r++)
+		{
+			for (int c = 0; c < 4; c++)
+			{
+				M[r][c] = FFloat4::Splat(Matrix.M[r][c]);
+			}
+		}
+	}
+
+	//  4 (bTranslate) Ǵ  4 ȯ. ະ 迭(X, Y, Z) ״ ޾Ƽ 
+	template<bool bTranslate>
+	void Transform(FFloat4& X, FFloat4& Y, FFloat4& Z) const
+	{
+		FFloat4 Out[3];
+
+		for (int r = 0; r < 3; r++)
+		{
+			FFloat4 R = bTranslate ? MultiplyAdd(M[r][0], X, M[r][3]) : M[r][0] * X;
+
+			R = MultiplyAdd(M[r][1], Y, R);
+			Out[r] = MultiplyAdd(M[r][2], Z, R);
+		}
+
+		X = Out[0];
+		Y = Out[1];
+		Z = Out[2];
+	}
+};
+
+// ̸ 1. ̰ 0 (vn  ) 0 
+inline void NormalizeLanes(FFloat4& X, FFloat4& Y, FFloat4& Z)
+{
+	const FFloat4 LengthSquared = X * X + Y * Y + Z * Z;
+	const FFloat4 Tiny = FFloat4::Splat(1e-30f);
+	const FFloat4 InvLength = Select(LessThan(LengthSquared, Tiny), FFloat4::Splat(0.0f), ReciprocalSqrt(Max(LengthSquared, Tiny)));
+
+	X = X * InvLength;
+	Y = Y * InvLength;
+	Z = Z * InvLength;
+}
+
+//  ȯ :  3x3 ġ (ũⰡ ึ ޶ 鿡  ä ). ̵ 0
+inline FMatrix GetNormalMatrix(const FMatrix& Matrix)
+{
+	FMatrix Result = Matrix.InverseAffine().Transpose();
+
+	Result.M[0][3] = Result.M[1][3] = Result.M[2][3] = 0.0f;
+	Result.M[3][0] = Result.M[3][1] = Result.M[3][2] = 0.0f;
+	Result.M[3][3] = 1.0f;
+
+	return Result;
+}
+
+// FVector 迭 4 ະ Ƽ ȯ. In == Out(ڸ) 
+template<bool bTranslate>
+inline void TransformVectorRange(const FMatrixLanes& Lanes, const FVector* In, FVector* Out, size_t Begin, size_t End, bool bNormalize)
+{
+	size_t i = Begin;
+
+	for (; i + 4 <= End; i += 4)
+	{
+		float Values[3][4];
+
+		for (int l = 0; l < 4; l++)
+		{
+			Values[0][l] = In[i + l].x;
+			Values[1][l] = In[i + l].y;
+			Values[2][l] = In[i + l].z;
+		}
+
+		FFloat4 X = FFloat4::Load(Values[0]);
+		FFloat4 Y = FFloat4::Load(Values[1]);
+		FFloat4 Z = FFloat4::Load(Values[2]);
+
+		Lanes.Transform<bTranslate>(X, Y, Z);
+
+		if (bNormalize)
+		{
+			NormalizeLanes(X, Y, Z);
+		}
+
+		X.Store(Values[0]);
+		Y.Store(Values[1]);
+		Z.Store(Values[2]);
+
+		for (int l = 0; l < 4; l++)
+		{
+			Out[i + l] = FVector(Values[0][l], Values[1][l], Values[2][l]);
+		}
+	}
+
+	//  ϳ ( 0 )
+	for (; i < End; i++)
+	{
+		FFloat4 X = FFloat4::Splat(In[i].x);
+		FFloat4 Y = FFloat4::Splat(In[i].y);
+		FFloat4 Z = FFloat4::Splat(In[i].z);
+
+		Lanes.Transform<bTranslate>(X, Y, Z);
+
+		if (bNormalize)
+		{
+			NormalizeLanes(X, Y, Z);
+		}
+
+		float x[4], y[4], z[4];
+		X.Store(x);
+		Y.Store(y);
+		Z.Store(z);
+
+		Out[i] = FVector(x[0], y[0], z[0]);
+	}
+}
+
+// ġ 迭 ȯ (w = 1).    Ǯ ó
+inline void TransformPositions(const FMatrix& Matrix, const FVector* In, FVector* Out, size_t Count, FThreadPool& Pool = FThreadPool::Get())
+{
+	const FMatrixLanes Lanes(Matrix);
+
+	ParallelForRanges(Pool, Count, MinElementsPerTask, [&](size_t Begin, size_t End)
+	{
+		TransformVectorRange<true>(Lanes, In, Out, Begin, End, false);
+	});
+}
+
+//  迭 ȯ (w = 0). bNormalize ȯ   1
+inline void TransformDirections(const FMatrix& Matrix, const FVector* In, FVector* Out, size_t Count, bool bNormalize, FThreadPool& Pool = FThreadPool::Get())
+{
+	const FMatrixLanes Lanes(Matrix);
+
+	ParallelForRanges(Pool, Count, MinElementsPerTask, [&](size_t Begin, size_t End)
+	{
+		TransformVectorRange<false>(Lanes, In, Out, Begin, End, bNormalize);
+	});
+}
+
+//  迭 ȯ (Matrix ġ ȯ  ȭ)
+inline void TransformNormals(const FMatrix& Matrix, const FVector* In, FVector* Out, size_t Count, FThreadPool& Pool = FThreadPool::Get())
+{
+	TransformDirections(GetNormalMatrix(Matrix), In, Out, Count, true, Pool);
+}
+
+//  Ʈ ȯ: Location Matrix, Normal ġ ȯ  ȭ, TexCoord ״. In == Out(ڸ) 
+//  4 [x y z u] / [v nx ny nz]   о ġϸ ະ  ǰ, ٽ ġؼ ״ 
+//    а    SSE2  ھ ġ ȯ/ȭ  ̶ memcpy ӵ  
+inline void TransformVertices(const FMatrix& Matrix, const Vertex* In, Vertex* Out, size_t Count, FThreadPool& Pool = FThreadPool::Get())
+{
+	const FMatrixLanes PositionLanes(Matrix);
+	const FMatrixLanes NormalLanes(GetNormalMatrix(Matrix));
+
+	auto Kernel = [&](FFloat4 (&A)[4], FFloat4 (&B)[4])
+	{
+		Transpose4(A[0], A[1], A[2], A[3]);	// X, Y, Z, U
+		Transpose4(B[0], B[1], B[2], B[3]);	// V, NX, NY, NZ
+
+		PositionLanes.Transform<true>(A[0], A[1], A[2]);
+		NormalLanes.Transform<false>(B[1], B[2], B[3]);
+		NormalizeLanes(B[1], B[2], B[3]);
+
+		Transpose4(A[0], A[1], A[2], A[3]);
+		Transpose4(B[0], B[1], B[2], B[3]);
+	};
+
+	ParallelForRanges(Pool, Count, MinElementsPerTask, [&](size_t Begin, size_t End)
+	{
+		size_t i = Begin;
+
+		for (; i + 4 <= End; i += 4)
+		{
+			const float* Source = &In[i].Location.x;
+			float* Target = &Out[i].Location.x;
+
+			FFloat4 A[4] = { FFloat4::Load(Source), FFloat4::Load(Source + 8), FFloat4::Load(Source + 16), FFloat4::Load(Source + 24) };
+			FFloat4 B[4] = { FFloat4::Load(Source + 4), FFloat4::Load(Source + 12), FFloat4::Load(Source + 20), FFloat4::Load(Source + 28) };
+
+			Kernel(A, B);
+
+			A[0].Store(Target);			B[0].Store(Target + 4);
+			A[1].Store(Target + 8);		B[1].Store(Target + 12);
+			A[2].Store(Target + 16);	B[2].Store(Target + 20);
+			A[3].Store(Target + 24);	B[3].Store(Target + 28);
+		}
+
+		// (4 ̸)    ο ä ϰ   
+		if (i < End)
+		{
+			const int NumLanes = static_cast<int>(End - i);
+			FFloat4 A[4], B[4];
+
+			for (int l = 0; l < 4; l++)
+			{
+				const float* Source = &In[i + min(l, NumLanes - 1)].Location.x;
+
+				A[l] = FFloat4::Load(Source);
+				B[l] = FFloat4::Load(Source + 4);
+			}
+
+			Kernel(A, B);
+
+			for (int l = 0; l < NumLanes; l++)
+			{
+				A[l].Store(&Out[i + l].Location.x);
+				B[l].Store(&Out[i + l].Location.x + 4);
+			}
+		}
+	});
+}
+
+//   Ʈ   纻. /źƮ ȯϰ ٿ带 ٽ 
+// Ľ (ſ) ո  ǵ ﰢ   źƮ ȣ 
+inline void BakeWorldSpace(const UStaticMesh& InUStaticMesh, const FMatrix& World, UStaticMesh& OutUStaticMesh, FThreadPool& Pool = FThreadPool::Get())
+{
+	const bool bMirrored = World.Determinant() < 0.0f;
+
+	OutUStaticMesh.Vertices.resize(InUStaticMesh.Vertices.size());
+	OutUStaticMesh.Indices = InUStaticMesh.Indices;
+	OutUStaticMesh.Sections = InUStaticMesh.Sections;
+	OutUStaticMesh.MaterialLibraries = InUStaticMesh.MaterialLibraries;
+	OutUStaticMesh.Tangents.resize(InUStaticMesh.Tangents.size());
+
+	TransformVertices(World, InUStaticMesh.Vertices.data(), OutUStaticMesh.Vertices.data(), InUStaticMesh.Vertices.size(), Pool);
+
+	if (!InUStaticMesh.Tangents.empty())
+	{
+		const vector<FTangent>& InTangents = InUStaticMesh.Tangents;
+		vector<FTangent>& OutTangents = OutUStaticMesh.Tangents;
+		const vector<Vertex>& OutVertices = OutUStaticMesh.Vertices;
+
+		// ȯ źƮ     ȭ (Gram-Schmidt). Է źƮ  Ȯ  ƴϾ   
+		//  ų źƮ   GenerateTangentsó   ƹ 
+		ParallelForRanges(Pool, InTangents.size(), MinElementsPerTask, [&](size_t Begin, size_t End)
+		{
+			for (size_t i = Begin; i < End; i++)
+			{
+				const FVector& N = OutVertices[i].Normal;
+				const FVector D = World.TransformDirection(InTangents[i].Direction);
+				const float Projection = Dot(N, D);
+				const FVector Axis = (fabsf(N.x) < 0.9f) ? FVector(1.0f, 0.0f, 0.0f) : FVector(0.0f, 1.0f, 0.0f);
+
+				OutTangents[i].Direction = NormalizeOr(FVector(D.x - N.x * Projection, D.y - N.y * Projection, D.z - N.z * Projection), NormalizeOr(Cross(N, Axis), Axis));
+				OutTangents[i].BitangentSign = bMirrored ? -InTangents[i].BitangentSign : InTangents[i].BitangentSign;
+			}
+		});
+	}
+
+	if (bMirrored)
+	{
+		vector<int>& Indices = OutUStaticMesh.Indices;
+
+		for (size_t t = 0; t + 2 < Indices.size(); t += 3)
+		{
+			swap(Indices[t + 1], Indices[t + 2]);
+		}
+	}
+
+	ComputeMeshBounds(OutUStaticMesh, Pool);
+}
@@ -0,0 +1,260 @@
+#pragma once
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Structs.h"
+
+struct MtlMaterial {
+    std::string Name;
+
+    float Ns = 0.f;        // Specular exponent
+    FVector Ka{ 0,0,0 };      // Ambient
+    FVector Kd{ 0,0,0 };      // Diffuse
+    FVector Ks{ 0,0,0 };      // Specular
+    FVector Ke{ 0,0,0 };      // Emissive
+    float Ni = 1.f;        // IOR
+
+    float d = 1.f;        // Opacity (1=opaque)
+    int   illum = 2;       // Shading model
+
+    std::string map_Kd;    // Diffuse map
+    std::string map_Ks;    // Specular map (optional)
+    std::string map_Ke;    // Emissive map (optional)
+    std::string map_Ns;    // Specular exponent map (optional)
+    std::string map_d;     // Opacity map (optional)
+
+    // Normal/Bump
+    std::string map_Bump;  // bump/normal map file
+    float bumpScale = 1.f; // -bm 
+
+    // ʿ  ߰ Ű  Ȯ 
+};
+
+static inline void trim(std::string& t) {
+    auto notsp = [](unsigned char c) { return !std::isspace(c); };
+    t.erase(t.begin(), std::find_if(t.begin(), t.end(), notsp));
+    t.erase(std::find_if(t.rbegin(), t.rend(), notsp).base(), t.end());
+}
+
+// ---- Ű ̺ ----------------------------------------------------------
+// Ű ڿ  Ÿӿ ã õ ؽؼ ٷ   (浹   ؽ)
+// Ÿ 񱳴  ϳ ڿ   
+
+enum class MtlKey : uint8_t {
+    Unknown,
+    newmtl,
+    Ns, Ni, d, illum,
+    Ka, Kd, Ks, Ke,
+    map_Kd, map_Ks, map_Ke, map_Ns, map_d,
+    map_Bump,
+};
+
+struct MtlKeyword {
+    std::string_view Name;
+    MtlKey Key = MtlKey::Unknown;
+};
+
+inline constexpr MtlKeyword MtlKeywords[] = {
+    { "newmtl", MtlKey::newmtl },
+    { "Ns", MtlKey::Ns }, { "Ni", MtlKey::Ni }, { "d", MtlKey::d }, { "illum", MtlKey::illum },
+    { "Ka", MtlKey::Ka }, { "Kd", MtlKey::Kd }, { "Ks", MtlKey::Ks }, { "Ke", MtlKey::Ke },
+    { "map_Kd", MtlKey::map_Kd }, { "map_Ks", MtlKey::map_Ks }, { "map_Ke", MtlKey::map_Ke },
+    { "map_Ns", MtlKey::map_Ns }, { "map_d", MtlKey::map_d },
+    { "map_Bump", MtlKey::map_Bump }, { "bump", MtlKey::map_Bump },
+};
+
+constexpr uint32_t MtlKeyTableSize = 32;   // 2 ŵ (  ũ)
+
+constexpr uint32_t hashMtlKey(std::string_view s, uint32_t seed) {
+    uint32_t h = seed;
+    for (char c : s) h = (h ^ static_cast<unsigned char>(c)) * 16777619u;
+    return (h ^ (h >> 15)) & (MtlKeyTableSize - 1);
+}
+
+constexpr bool isPerfectMtlKeySeed(uint32_t seed) {
+    bool used[MtlKeyTableSize] = {};
+    for (const MtlKeyword& k : MtlKeywords) {
+        uint32_t slot = hashMtlKey(k.Name, seed);
+        if (used[slot]) return false;
+        used[slot] = true;
+    }
+    return true;
+}
+
+constexpr uint32_t findMtlKeySeed() {
+    for (uint32_t seed = 2166136261u; seed < 2166136261u + 4096; ++seed) {
+        if (isPerfectMtlKeySeed(seed)) return seed;
+    }
+    return 0;
+}
+
+constexpr uint32_t MtlKeySeed = findMtlKeySeed();
+static_assert(MtlKeySeed != 0, "MTL Ű  ؽ õ带 ã  (̺ ũ⸦ ø )");
+
+struct MtlKeyTable {
+    MtlKeyword Slots[MtlKeyTableSize] = {};
+
+    constexpr MtlKeyTable() {
+        for (const MtlKeyword& k : MtlKeywords) {
+            MtlKeyword& slot = Slots[hashMtlKey(k.Name, MtlKeySeed)];
+            slot.Name = k.Name;
+            slot.Key = k.Key;
+        }
+    }
+};
+
+inline constexpr MtlKeyTable MtlKeyLookup{};
+
+constexpr MtlKey findMtlKey(std::string_view key) {
+    const MtlKeyword& slot = MtlKeyLookup.Slots[hashMtlKey(key, MtlKeySeed)];
+    return slot.Name == key ? slot.Key : MtlKey::Unknown;
+}
+
+static_assert(findMtlKey("map_Bump") == MtlKey::map_Bump && findMtlKey("bump") == MtlKey::map_Bump);
+static_assert(findMtlKey("Kd") == MtlKey::Kd && findMtlKey("Tf") == MtlKey::Unknown);
+
+// ----  --------------------------------------------------------------------
+// Է ۸ Ű string_view ְ   (޸ ε  ״ Ѱܵ )
+
+inline bool isMtlSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+//  ū ߶. ūǥ  ū    ū (: "House T3N.png")
+inline bool nextToken(std::string_view& line, std::string_view& out) {
+    size_t i = 0, n = line.size();
+    while (i < n && isMtlSpace(line[i])) ++i;
+    if (i >= n) { line = {}; return false; }
+
+    size_t start, end;
+    if (line[i] == '"') {
+        start = ++i;
+        while (i < n && line[i] != '"') ++i;
+        end = i;
+        if (i < n) ++i;
+    }
+    else {
+        start = i;
+        while (i < n && !isMtlSpace(line[i])) ++i;
+        end = i;
+    }
+
+    out = line.substr(start, end - start);
+    line.remove_prefix(i);
+    return true;
+}
+
+// ū ü ڿ  ('+' ȣ from_chars  Ƿ  ǳʶ)
+inline bool parseFloat(std::string_view sv, float& out) {
+    const char* first = sv.data();
+    const char* last = first + sv.size();
+    if (first < last && *first == '+') ++first;
+
+    float v;
+    auto [ptr, ec] = std::from_chars(first, last, v);
+    if (ec == std::errc() && ptr == last && first < last) { out = v; return true; }
+    return false;
+}
+
+inline bool parseFloat3(std::string_view line, FVector& out) {
+    std::string_view x, y, z;
+    FVector v;
+    if (!nextToken(line, x) || !nextToken(line, y) || !nextToken(line, z)) return false;
+    if (!parseFloat(x, v.x) || !parseFloat(y, v.y) || !parseFloat(z, v.z)) return false;
+    out = v;
+    return true;
+}
+
+inline void parseMapWithOptions(std::string_view rest, std::string& outFile, float* outBm /*nullable*/) {
+    // map_* ο ɼ(-bm ) ϸ и
+    // : map_Bump -bm 2.9 "House T3N.png"
+    float bm = outBm ? *outBm : 1.f;
+    std::string_view file, tok;
+    while (nextToken(rest, tok)) {
+        if (tok == "-bm") {
+            std::string_view value;
+            if (nextToken(rest, value)) {
+                float v;
+                if (parseFloat(value, v)) bm = v;
+            }
+        }
+        else if (!tok.empty()) {
+            file = tok; //  ū Ϸ 
+        }
+    }
+    if (!file.empty()) outFile.assign(file.data(), file.size());
+    if (outBm) *outBm = bm;
+}
+
+//  ̺귯 ؽƮ ü Ľؼ outMats ڿ ߰
+//  Ҵ  迭 ̸/ؽó  ڿ (/ū/ڴ Է ۸  )
+inline void parseMtl(std::string_view text, std::vector<MtlMaterial>& outMats) {
+    MtlMaterial discard;          // ù newmtl (Ǵ ̸  newmtl ) Ӽ 
+    MtlMaterial* cur = &discard;
+
+    const char* p = text.data();
+    const char* end = p + text.size();
+
+    while (p < end) {
+        const char* lineEnd = static_cast<const char*>(std::memchr(p, '\n', end - p));
+        if (lineEnd == nullptr) lineEnd = end;
+
+        std::string_view line(p, lineEnd - p);
+        p = lineEnd + (lineEnd < end ? 1 : 0);
+
+        std::string_view key;
+        if (!nextToken(line, key) || key[0] == '#') continue;
+
+        switch (findMtlKey(key)) {
+        case MtlKey::newmtl: {
+            std::string_view name;
+            if (nextToken(line, name)) {
+                outMats.emplace_back();
+                cur = &outMats.back();
+                cur->Name.assign(name.data(), name.size());
+            }
+            else {
+                cur = &discard;
+            }
+            break;
+        }
+        case MtlKey::Ns: { std::string_view t; if (nextToken(line, t)) parseFloat(t, cur->Ns); break; }
+        case MtlKey::Ni: { std::string_view t; if (nextToken(line, t)) parseFloat(t, cur->Ni); break; }
+        case MtlKey::d: { std::string_view t; if (nextToken(line, t)) parseFloat(t, cur->d); break; }
+        case MtlKey::illum: {
+            std::string_view t;
+            float f;
+            if (nextToken(line, t) && parseFloat(t, f)) cur->illum = static_cast<int>(f);
+            break;
+        }
+        case MtlKey::Ka: parseFloat3(line, cur->Ka); break;
+        case MtlKey::Kd: parseFloat3(line, cur->Kd); break;
+        case MtlKey::Ks: parseFloat3(line, cur->Ks); break;
+        case MtlKey::Ke: parseFloat3(line, cur->Ke); break;
+        case MtlKey::map_Kd: parseMapWithOptions(line, cur->map_Kd, nullptr); break;
+        case MtlKey::map_Ks: parseMapWithOptions(line, cur->map_Ks, nullptr); break;
+        case MtlKey::map_Ke: parseMapWithOptions(line, cur->map_Ke, nullptr); break;
+        case MtlKey::map_Ns: parseMapWithOptions(line, cur->map_Ns, nullptr); break;
+        case MtlKey::map_d: parseMapWithOptions(line, cur->map_d, nullptr); break;
+        case MtlKey::map_Bump: parseMapWithOptions(line, cur->map_Bump, &cur->bumpScale); break;
+        default:
+            // TODO: ʿϸ α/Ŀ Ӽ 
+            break;
+        }
+    }
+}
+
+// Ʈ Է¿ (ü      ļ ѱ).  FMappedFile::View() ٷ ѱ  
+inline void parseMtl(std::istream& is, std::vector<MtlMaterial>& outMats) {
+    std::string text((std::istreambuf_iterator<char>(is)), std::istreambuf_iterator<char>());
+    parseMtl(std::string_view(text), outMats);
+}
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+// ڿ  ̺   ϰ  ID  ٴϴ ̸ (/׷ ̸ )
+// /ؽô ID Ƿ ڿ 񱳰 . ID 0  ̸(None)
+struct FName
+{
+	uint32_t Id = 0;
+
+	FName() = default;
+
+	explicit FName(std::string_view InName)
+		: Id(Intern(InName))
+	{
+	}
+
+	bool IsNone() const
+	{
+		return Id == 0;
+	}
+
+	const std::string& ToString() const
+	{
+		FTable& Table = GetTable();
+		std::shared_lock<std::shared_mutex> Lock(Table.Mutex);
+
+		return Table.Names[Id];
+	}
+
+	bool operator==(const FName& Other) const
+	{
+		return Id == Other.Id;
+	}
+
+	bool operator!=(const FName& Other) const
+	{
+		return Id != Other.Id;
+	}
+
+private:
+	struct FTable
+	{
+		std::shared_mutex Mutex;
+		std::deque<std::string> Names{ std::string() };	// deque ߰ص  ڿ ּҰ ״ 
+		std::unordered_map<std::string_view, uint32_t> Ids;
+	};
+
+	static FTable& GetTable()
+	{
+		static FTable Table;
+		return Table;
+	}
+
+	// ̹ ִ ̸ б ݸ ã, ó  ̸   ߰ ( Ľ ûũ ÿ ȣ)
+	static uint32_t Intern(std::string_view InName)
+	{
+		if (InName.empty())
+		{
+			return 0;
+		}
+
+		FTable& Table = GetTable();
+
+		{
+			std::shared_lock<std::shared_mutex> Lock(Table.Mutex);
+			auto It = Table.Ids.find(InName);
+
+			if (It != Table.Ids.end())
+			{
+				return It->second;
+			}
+		}
+
+		std::unique_lock<std::shared_mutex> Lock(Table.Mutex);
+		auto It = Table.Ids.find(InName);
+
+		if (It != Table.Ids.end())
+		{
+			return It->second;
+		}
+
+		const uint32_t NewId = static_cast<uint32_t>(Table.Names.size());
+		Table.Names.emplace_back(InName);
+		Table.Ids.emplace(std::string_view(Table.Names.back()), NewId);
+
+		return NewId;
+	}
+};
+
+namespace std
+{
+	template<>
+	struct hash<FName>
+	{
+		size_t operator()(const FName& Name) const
+		{
+			return hash<uint32_t>()(Name.Id);
+		}
+	};
+}
@@ -1,164 +1,22 @@
+#include <chrono>
+#include <cstdlib>
 #include <iostream>
-#include <string>
-#include <vector>
-#include <unordered_map>
+#include <new>
 #include <sstream>
-#include <algorithm>
-#include <cctype>
-#include <cstdlib>
-#include <cerrno>
-
-struct FVector 
-{ 
-    float x = 0;
-    float y = 0;
-    float z = 0;
-};
-
-struct MtlMaterial {
-    std::string Name;
-
-    float Ns = 0.f;        // Specular exponent
-    FVector Ka{ 0,0,0 };      // Ambient
-    FVector Kd{ 0,0,0 };      // Diffuse
-    FVector Ks{ 0,0,0 };      // Specular
-    FVector Ke{ 0,0,0 };      // Emissive
-    float Ni = 1.f;        // IOR
-
-    float d = 1.f;        // Opacity (1=opaque)
-    int   illum = 2;       // Shading model
-
-    std::string map_Kd;    // Diffuse map
-    std::string map_Ks;    // Specular map (optional)
-    std::string map_Ke;    // Emissive map (optional)
-    std::string map_Ns;    // Specular exponent map (optional)
-    std::string map_d;     // Opacity map (optional)
-
-    // Normal/Bump
-    std::string map_Bump;  // bump/normal map file
-    float bumpScale = 1.f; // -bm 
-
-    // ʿ  ߰ Ű  Ȯ 
-};
-
-static inline void trim(std::string& t) {
-    auto notsp = [](unsigned char c) { return !std::isspace(c); };
-    t.erase(t.begin(), std::find_if(t.begin(), t.end(), notsp));
-    t.erase(std::find_if(t.rbegin(), t.rend(), notsp).base(), t.end());
-}
-
-static std::vector<std::string> tokenize(std::string_view sv) {
-    std::vector<std::string> out;
-    size_t i = 0, n = sv.size();
-    while (i < n) {
-        while (i < n && std::isspace(static_cast<unsigned char>(sv[i]))) ++i;
-        if (i >= n) break;
-
-        if (sv[i] == '"') {
-            ++i;
-            size_t start = i;
-            while (i < n && sv[i] != '"') ++i;
-            out.emplace_back(sv.substr(start, i - start));
-            if (i < n && sv[i] == '"') ++i;
-        }
-        else {
-            size_t start = i;
-            while (i < n && !std::isspace(static_cast<unsigned char>(sv[i]))) ++i;
-            out.emplace_back(sv.substr(start, i - start));
-        }
-    }
-    return out;
-}
 
-static bool parseFloat(std::string_view sv, float& out) {
-    std::string tmp(sv);
-    char* end = nullptr;
-    errno = 0;
-    float v = std::strtof(tmp.c_str(), &end);
-    if (end == tmp.c_str() + tmp.size() && errno != ERANGE) { out = v; return true; }
-    return false;
-}
+#include "MtlParser.h"
 
-static bool parseFloat3(const std::vector<std::string>& t, size_t i, FVector& out) {
-    if (i + 2 >= t.size()) return false;
-    return parseFloat(t[i], out.x) && parseFloat(t[i + 1], out.y) && parseFloat(t[i + 2], out.z);
-}
+// Ľ   Ҵ Ƚ Ȯο
+static size_t AllocationCount = 0;
 
-static void parseMapWithOptions(const std::vector<std::string>& tok, size_t start,
-    std::string& outFile, float* outBm /*nullable*/) {
-    // map_* ο ɼ(-bm ) ϸ и
-    // : map_Bump -bm 2.9 "House T3N.png"
-    float bm = outBm ? *outBm : 1.f;
-    std::string file;
-    for (size_t i = start; i < tok.size(); ++i) {
-        if (tok[i] == "-bm" && i + 1 < tok.size()) {
-            float v;
-            if (parseFloat(tok[i + 1], v)) bm = v;
-            ++i; //  ŵ
-        }
-        else if (!tok[i].empty()) {
-            file = tok[i]; //  ū Ϸ  (    ũ ̹  ū)
-        }
-    }
-    if (!file.empty()) outFile = std::move(file);
-    if (outBm) *outBm = bm;
+void* operator new(size_t size) {
+    ++AllocationCount;
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
 }
 
-static void parseMtl(std::istream& is, std::vector<MtlMaterial>& outMats) {
-    std::string line;
-    MtlMaterial cur;
-    bool hasCur = false;
-
-    auto flushCurrent = [&]() {
-        if (hasCur) outMats.push_back(cur);
-        cur = MtlMaterial{};
-        hasCur = false;
-        };
-
-    while (std::getline(is, line)) {
-        trim(line);
-        if (line.empty() || line[0] == '#') continue;
-
-        // key + rest
-        size_t sp = line.find_first_of(" \t");
-        std::string key = (sp == std::string::npos) ? line : line.substr(0, sp);
-        std::string rest = (sp == std::string::npos) ? "" : line.substr(sp + 1);
-        trim(rest);
-
-        auto tok = tokenize(rest);
-
-        if (key == "newmtl") {
-            //   flush
-            flushCurrent();
-            if (!tok.empty()) { cur.Name = tok[0]; hasCur = true; }
-        }
-        else if (key == "Ns" && !tok.empty()) { parseFloat(tok[0], cur.Ns); }
-        else if (key == "Ni" && !tok.empty()) { parseFloat(tok[0], cur.Ni); }
-        else if (key == "d" && !tok.empty()) { parseFloat(tok[0], cur.d); }
-        else if (key == "illum" && !tok.empty()) {
-            float f; if (parseFloat(tok[0], f)) cur.illum = static_cast<int>(f);
-        }
-        else if (key == "Ka") { FVector v; if (parseFloat3(tok, 0, v)) cur.Ka = v; }
-        else if (key == "Kd") { FVector v; if (parseFloat3(tok, 0, v)) cur.Kd = v; }
-        else if (key == "Ks") { FVector v; if (parseFloat3(tok, 0, v)) cur.Ks = v; }
-        else if (key == "Ke") { FVector v; if (parseFloat3(tok, 0, v)) cur.Ke = v; }
-        else if (key == "map_Kd") { parseMapWithOptions(tok, 0, cur.map_Kd, nullptr); }
-        else if (key == "map_Ks") { parseMapWithOptions(tok, 0, cur.map_Ks, nullptr); }
-        else if (key == "map_Ke") { parseMapWithOptions(tok, 0, cur.map_Ke, nullptr); }
-        else if (key == "map_Ns") { parseMapWithOptions(tok, 0, cur.map_Ns, nullptr); }
-        else if (key == "map_d") { parseMapWithOptions(tok, 0, cur.map_d, nullptr); }
-        else if (key == "map_Bump" || key == "bump") {
-            parseMapWithOptions(tok, 0, cur.map_Bump, &cur.bumpScale);
-        }
-        else {
-            // TODO: ʿϸ α/Ŀ Ӽ 
-            // std::cerr << "Unknown key: " << key << "\n";
-        }
-    }
-
-    //   flush
-    flushCurrent();
-}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
 
 int main() {
     const char* text =
@@ -173,9 +31,8 @@ int main() {
         "map_Kd HouseT3.png\n"
         "map_Bump -bm 2.900000 \"House T3N.png\"\n";
 
-    std::istringstream iss(text);
     std::vector<MtlMaterial> mats;
-    parseMtl(iss, mats);
+    parseMtl(std::string_view(text), mats);
 
     //  Ȯ
     for (auto& m : mats) {
@@ -188,4 +45,38 @@ int main() {
         std::cout << "  map_Kd=" << m.map_Kd << "\n";
         std::cout << "  map_Bump=" << m.map_Bump << " (bm=" << m.bumpScale << ")\n";
     }
+
+    // ū ̺귯:    (̸ ª SSO ڿ Ҵ絵 )
+    const int count = 50000;
+    std::ostringstream big;
+    for (int i = 0; i < count; ++i) {
+        big << "# material " << i << "\r\n"
+            << "newmtl M" << i << "\r\n"
+            << "Ns " << (i % 100) << ".5\r\n"
+            << "Kd 0.8 " << (i % 10) * 0.1f << " +0.25\r\n"
+            << "illum 2\r\n"
+            << "Tf 1 1 1\r\n"
+            << "map_Kd T" << (i % 7) << ".png\r\n";
+    }
+    const std::string library = big.str();
+
+    std::vector<MtlMaterial> bigMats;
+    bigMats.reserve(count);
+
+    const size_t before = AllocationCount;
+    auto start = std::chrono::steady_clock::now();
+    parseMtl(std::string_view(library), bigMats);
+    auto end = std::chrono::steady_clock::now();
+    const size_t allocations = AllocationCount - before;
+
+    bool valid = bigMats.size() == count;
+    for (int i = 0; valid && i < count; ++i) {
+        const MtlMaterial& m = bigMats[i];
+        valid = m.Name == "M" + std::to_string(i) && m.Ns == (i % 100) + 0.5f && m.Kd.z == 0.25f
+            && m.illum == 2 && m.map_Kd == "T" + std::to_string(i % 7) + ".png";
+    }
+
+    std::cout << "\n" << count << " materials, " << library.size() / 1024 << " KB: "
+        << std::chrono::duration<double, std::milli>(end - start).count() << " ms, "
+        << allocations << " allocations, " << (valid ? "O" : "X") << "\n";
 }
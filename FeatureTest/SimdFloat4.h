@@ -0,0 +1,164 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+
+// x64(MSVC) SSE2  GCC/Clang SSE2,  ܿ float 4   䳻
+#if defined(_M_X64) || defined(_M_AMD64) || defined(__SSE2__)
+#define SIMD_SSE2 1
+#include <emmintrin.h>
+#else
+#define SIMD_SSE2 0
+#endif
+
+// FMA Ϸ ɼ   (/arch:AVX2, -mfma).  ϰ ϱ  
+#if SIMD_SSE2 && (defined(__FMA__) || defined(__AVX2__))
+#define SIMD_FMA 1
+#include <immintrin.h>
+#else
+#define SIMD_FMA 0
+#endif
+
+// float 4 . Ŀ ø   ۼϰ FFloat4(4) float( )  νϽȭ
+struct FFloat4
+{
+#if SIMD_SSE2
+	__m128 V;
+
+	FFloat4() = default;
+	FFloat4(__m128 InV) : V(InV) {}
+
+	static FFloat4 Splat(float Value) { return _mm_set1_ps(Value); }
+	static FFloat4 Set(float X, float Y, float Z, float W) { return _mm_setr_ps(X, Y, Z, W); }
+	static FFloat4 Load(const float* Source) { return _mm_loadu_ps(Source); }
+	static FFloat4 LoadAligned(const float* Source) { return _mm_load_ps(Source); }
+	void Store(float* Target) const { _mm_storeu_ps(Target, V); }
+	void StoreAligned(float* Target) const { _mm_store_ps(Target, V); }
+
+	FFloat4 operator+(FFloat4 R) const { return _mm_add_ps(V, R.V); }
+	FFloat4 operator-(FFloat4 R) const { return _mm_sub_ps(V, R.V); }
+	FFloat4 operator*(FFloat4 R) const { return _mm_mul_ps(V, R.V); }
+	FFloat4 operator/(FFloat4 R) const { return _mm_div_ps(V, R.V); }
+	FFloat4 operator-() const { return _mm_xor_ps(V, _mm_set1_ps(-0.0f)); }
+#else
+	float V[4];
+
+	FFloat4() = default;
+
+	static FFloat4 Splat(float Value) { FFloat4 R; R.V[0] = R.V[1] = R.V[2] = R.V[3] = Value; return R; }
+	static FFloat4 Set(float X, float Y, float Z, float W) { FFloat4 R; R.V[0] = X; R.V[1] = Y; R.V[2] = Z; R.V[3] = W; return R; }
+	static FFloat4 Load(const float* Source) { FFloat4 R; for (int i = 0; i < 4; i++) R.V[i] = Source[i]; return R; }
+	static FFloat4 LoadAligned(const float* Source) { return Load(Source); }
+	void Store(float* Target) const { for (int i = 0; i < 4; i++) Target[i] = V[i]; }
+	void StoreAligned(float* Target) const { Store(Target); }
+
+	FFloat4 operator+(FFloat4 R) const { for (int i = 0; i < 4; i++) R.V[i] = V[i] + R.V[i]; return R; }
+	FFloat4 operator-(FFloat4 R) const { for (int i = 0; i < 4; i++) R.V[i] = V[i] - R.V[i]; return R; }
+	FFloat4 operator*(FFloat4 R) const { for (int i = 0; i < 4; i++) R.V[i] = V[i] * R.V[i]; return R; }
+	FFloat4 operator/(FFloat4 R) const { for (int i = 0; i < 4; i++) R.V[i] = V[i] / R.V[i]; return R; }
+	FFloat4 operator-() const { FFloat4 R; for (int i = 0; i < 4; i++) R.V[i] = -V[i]; return R; }
+#endif
+};
+
+//   ũ (SSE2 κ Ʈ ũ, Į bool)
+#if SIMD_SSE2
+using FMask4 = FFloat4;
+
+inline FFloat4 Sqrt(FFloat4 A) { return _mm_sqrt_ps(A.V); }
+inline FFloat4 Min(FFloat4 A, FFloat4 B) { return _mm_min_ps(A.V, B.V); }
+inline FFloat4 Max(FFloat4 A, FFloat4 B) { return _mm_max_ps(A.V, B.V); }
+inline FFloat4 Abs(FFloat4 A) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), A.V); }
+inline FMask4 LessThan(FFloat4 A, FFloat4 B) { return _mm_cmplt_ps(A.V, B.V); }
+inline FFloat4 Select(FMask4 Mask, FFloat4 A, FFloat4 B) { return _mm_or_ps(_mm_and_ps(Mask.V, A.V), _mm_andnot_ps(Mask.V, B.V)); }
+inline int MoveMask(FMask4 Mask) { return _mm_movemask_ps(Mask.V); }
+inline FMask4 Or(FMask4 A, FMask4 B) { return _mm_or_ps(A.V, B.V); }
+inline void Transpose4(FFloat4& R0, FFloat4& R1, FFloat4& R2, FFloat4& R3) { _MM_TRANSPOSE4_PS(R0.V, R1.V, R2.V, R3.V); }
+template<int Lane> inline FFloat4 SplatLane(FFloat4 A) { return _mm_shuffle_ps(A.V, A.V, _MM_SHUFFLE(Lane, Lane, Lane, Lane)); }
+// 1/sqrt(A): ٻ簪(12Ʈ)    (   1e-7 , ȭ)
+inline FFloat4 ReciprocalSqrt(FFloat4 A)
+{
+	const __m128 Estimate = _mm_rsqrt_ps(A.V);
+	const __m128 Refine = _mm_sub_ps(_mm_set1_ps(3.0f), _mm_mul_ps(_mm_mul_ps(A.V, Estimate), Estimate));
+	return _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), Estimate), Refine);
+}
+#if SIMD_FMA
+inline FFloat4 MultiplyAdd(FFloat4 A, FFloat4 B, FFloat4 C) { return _mm_fmadd_ps(A.V, B.V, C.V); }
+#else
+inline FFloat4 MultiplyAdd(FFloat4 A, FFloat4 B, FFloat4 C) { return _mm_add_ps(_mm_mul_ps(A.V, B.V), C.V); }
+#endif
+#else
+struct FMask4
+{
+	bool V[4];
+};
+
+inline FFloat4 Sqrt(FFloat4 A) { for (int i = 0; i < 4; i++) A.V[i] = std::sqrt(A.V[i]); return A; }
+inline FFloat4 Min(FFloat4 A, FFloat4 B) { for (int i = 0; i < 4; i++) A.V[i] = std::min(A.V[i], B.V[i]); return A; }
+inline FFloat4 Max(FFloat4 A, FFloat4 B) { for (int i = 0; i < 4; i++) A.V[i] = std::max(A.V[i], B.V[i]); return A; }
+inline FFloat4 Abs(FFloat4 A) { for (int i = 0; i < 4; i++) A.V[i] = std::fabs(A.V[i]); return A; }
+inline FMask4 LessThan(FFloat4 A, FFloat4 B) { FMask4 M; for (int i = 0; i < 4; i++) M.V[i] = A.V[i] < B.V[i]; return M; }
+inline FFloat4 Select(FMask4 Mask, FFloat4 A, FFloat4 B) { for (int i = 0; i < 4; i++) A.V[i] = Mask.V[i] ? A.V[i] : B.V[i]; return A; }
+inline int MoveMask(FMask4 Mask) { int Bits = 0; for (int i = 0; i < 4; i++) Bits |= Mask.V[i] ? (1 << i) : 0; return Bits; }
+inline FMask4 Or(FMask4 A, FMask4 B) { for (int i = 0; i < 4; i++) A.V[i] = A.V[i] || B.V[i]; return A; }
+inline void Transpose4(FFloat4& R0, FFloat4& R1, FFloat4& R2, FFloat4& R3) { FFloat4* R[4] = { &R0, &R1, &R2, &R3 }; for (int i = 0; i < 4; i++) for (int j = i + 1; j < 4; j++) std::swap(R[i]->V[j], R[j]->V[i]); }
+template<int Lane> inline FFloat4 SplatLane(FFloat4 A) { return FFloat4::Splat(A.V[Lane]); }
+inline FFloat4 ReciprocalSqrt(FFloat4 A) { for (int i = 0; i < 4; i++) A.V[i] = 1.0f / std::sqrt(A.V[i]); return A; }
+inline FFloat4 MultiplyAdd(FFloat4 A, FFloat4 B, FFloat4 C) { return A * B + C; }
+#endif
+
+//  ó Į  (Ŀ ø  ̸ ȣ)
+inline float Sqrt(float A) { return std::sqrt(A); }
+inline float Min(float A, float B) { return std::min(A, B); }
+inline float Max(float A, float B) { return std::max(A, B); }
+inline float Abs(float A) { return std::fabs(A); }
+inline bool LessThan(float A, float B) { return A < B; }
+inline float Select(bool Mask, float A, float B) { return Mask ? A : B; }
+inline float MultiplyAdd(float A, float B, float C) { return A * B + C; }
+
+template<typename T> T LoadLanes(const float* Source);
+template<> inline float LoadLanes<float>(const float* Source) { return *Source; }
+template<> inline FFloat4 LoadLanes<FFloat4>(const float* Source) { return FFloat4::Load(Source); }
+
+// Source[Indices[0..3]] θ (float  Indices[0] ϳ)
+template<typename T> T GatherLanes(const float* Source, const int* Indices);
+template<> inline float GatherLanes<float>(const float* Source, const int* Indices) { return Source[Indices[0]]; }
+template<> inline FFloat4 GatherLanes<FFloat4>(const float* Source, const int* Indices) { return FFloat4::Set(Source[Indices[0]], Source[Indices[1]], Source[Indices[2]], Source[Indices[3]]); }
+
+inline void StoreLanes(float* Target, float Value) { *Target = Value; }
+inline void StoreLanes(float* Target, FFloat4 Value) { Value.Store(Target); }
+
+template<typename T> T SplatLanes(float Value);
+template<> inline float SplatLanes<float>(float Value) { return Value; }
+template<> inline FFloat4 SplatLanes<FFloat4>(float Value) { return FFloat4::Splat(Value); }
+
+// acos ٻ (Abramowitz & Stegun 4.4.45, ִ   7e-5 ). Է [-1, 1] ߶ 
+template<typename T>
+inline T FastAcos(T X)
+{
+	const T One = SplatLanes<T>(1.0f);
+
+	X = Max(Min(X, One), -One);
+
+	const T A = Abs(X);
+	const T Poly = SplatLanes<T>(1.5707288f) + A * (SplatLanes<T>(-0.2121144f) + A * (SplatLanes<T>(0.0742610f) + A * SplatLanes<T>(-0.0187293f)));
+	const T Result = Sqrt(One - A) * Poly;
+
+	return Select(LessThan(X, SplatLanes<T>(0.0f)), SplatLanes<T>(3.14159265f) - Result, Result);
+}
+
+// [Begin, End) 4 FFloat4,   float Kernel(Index, Lane Ÿ ±) ȣ
+template<typename F>
+inline void ForEachLanes(size_t Begin, size_t End, F&& Kernel)
+{
+	size_t i = Begin;
+
+	for (; i + 4 <= End; i += 4)
+	{
+		Kernel(i, FFloat4::Splat(0.0f));
+	}
+
+	for (; i < End; i++)
+	{
+		Kernel(i, 0.0f);
+	}
+}
@@ -0,0 +1,213 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// ߰  迭.  ũ   (MaxResidentBytes) ޸𸮿 ΰ
+// ġ      ӽ Ϸ ´ٰ ʿ  ٽ о 
+// ӽ  ų а  ϸ HasFailed() true ,  ڷ      (ٽ   0 ä)
+template<typename T>
+class TSpillArray
+{
+public:
+	static constexpr size_t PageElements = 4096;
+	static constexpr size_t PageBytes = PageElements * sizeof(T);
+
+	TSpillArray(size_t MaxResidentBytes, const std::string& InSpillPath)
+		: MaxResidentPages(std::max<size_t>(2, MaxResidentBytes / PageBytes))
+		, SpillPath(InSpillPath)
+	{
+	}
+
+	~TSpillArray()
+	{
+		if (SpillFile.is_open())
+		{
+			SpillFile.close();
+			std::remove(SpillPath.c_str());
+		}
+	}
+
+	TSpillArray(const TSpillArray&) = delete;
+	TSpillArray& operator=(const TSpillArray&) = delete;
+
+	void Add(const T& Element)
+	{
+		const size_t PageIndex = Count / PageElements;
+
+		if (PageIndex == PageSlots.size())
+		{
+			PageSlots.push_back(-1);
+			bOnDisk.push_back(false);
+		}
+
+		FPage& Page = GetPage(PageIndex);
+		Page.Elements[Count % PageElements] = Element;
+		Count++;
+	}
+
+	//    ٽ о Ƿ const ƴ
+	const T& operator[](size_t Index)
+	{
+		return GetPage(Index / PageElements).Elements[Index % PageElements];
+	}
+
+	size_t Num() const
+	{
+		return Count;
+	}
+
+	size_t GetResidentBytes() const
+	{
+		return Pages.size() * PageBytes;
+	}
+
+	size_t GetSpilledBytes() const
+	{
+		return SpilledBytes;
+	}
+
+	bool HasFailed() const
+	{
+		return bFailed;
+	}
+
+private:
+	struct FPage
+	{
+		std::vector<T> Elements;
+		size_t PageIndex = 0;
+		uint64_t LastUse = 0;
+	};
+
+	FPage& GetPage(size_t PageIndex)
+	{
+		int Slot = PageSlots[PageIndex];
+
+		if (Slot < 0)
+		{
+			Slot = AcquireSlot();
+
+			FPage& Page = Pages[Slot];
+			Page.PageIndex = PageIndex;
+			PageSlots[PageIndex] = Slot;
+
+			if (bOnDisk[PageIndex] && !ReadPage(PageIndex, Page))
+			{
+				std::fill(Page.Elements.begin(), Page.Elements.end(), T());
+				bFailed = true;
+			}
+		}
+
+		FPage& Page = Pages[Slot];
+		Page.LastUse = ++UseCounter;
+
+		return Page;
+	}
+
+	//    LRU     
+	int AcquireSlot()
+	{
+		if (Pages.size() < MaxResidentPages)
+		{
+			Pages.emplace_back();
+			Pages.back().Elements.resize(PageElements);
+			return static_cast<int>(Pages.size() - 1);
+		}
+
+		int Victim = 0;
+
+		for (int i = 1; i < static_cast<int>(Pages.size()); i++)
+		{
+			if (Pages[i].LastUse < Pages[Victim].LastUse)
+			{
+				Victim = i;
+			}
+		}
+
+		FPage& Page = Pages[Victim];
+
+		//  ä  ٲ Ƿ ó      (ä    Ź )
+		const bool bTailPage = Page.PageIndex == Count / PageElements;
+
+		if (!bOnDisk[Page.PageIndex] || bTailPage)
+		{
+			if (WritePage(Page))
+			{
+				SpilledBytes += bOnDisk[Page.PageIndex] ? 0 : PageBytes;
+				bOnDisk[Page.PageIndex] = true;
+			}
+			else
+			{
+				bFailed = true;
+			}
+		}
+
+		PageSlots[Page.PageIndex] = -1;
+
+		return Victim;
+	}
+
+	//  ڿ  ȣ  õ ʵ Ź  ¸  
+	bool WritePage(const FPage& Page)
+	{
+		if (!SpillFile.is_open())
+		{
+			SpillFile.open(SpillPath, std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc);
+
+			if (!SpillFile.is_open())
+			{
+				return false;
+			}
+		}
+
+		SpillFile.clear();
+		SpillFile.seekp(static_cast<std::streamoff>(Page.PageIndex) * PageBytes);
+
+		if (!SpillFile.good())
+		{
+			return false;
+		}
+
+		SpillFile.write(reinterpret_cast<const char*>(Page.Elements.data()), PageBytes);
+		SpillFile.flush();
+
+		return SpillFile.good();
+	}
+
+	bool ReadPage(size_t PageIndex, FPage& Page)
+	{
+		if (!SpillFile.is_open())
+		{
+			return false;
+		}
+
+		SpillFile.clear();
+		SpillFile.seekg(static_cast<std::streamoff>(PageIndex) * PageBytes);
+
+		if (!SpillFile.good())
+		{
+			return false;
+		}
+
+		SpillFile.read(reinterpret_cast<char*>(Page.Elements.data()), PageBytes);
+
+		return SpillFile.good() && static_cast<size_t>(SpillFile.gcount()) == PageBytes;
+	}
+
+	std::vector<FPage> Pages;
+	std::vector<int> PageSlots;	//  ȣ -> Pages  (-1 = ũ )
+	std::vector<bool> bOnDisk;
+	size_t Count = 0;
+	size_t MaxResidentPages;
+	size_t SpilledBytes = 0;
+	uint64_t UseCounter = 0;
+	bool bFailed = false;
+
+	std::string SpillPath;
+	std::fstream SpillFile;
+};
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <iostream>
 #include <fstream>
 #include <vector>
@@ -8,6 +11,8 @@
 
 #include "map"
 
+#include "NameTable.h"
+
 using namespace std;
 
 struct FVector
@@ -16,7 +21,77 @@ struct FVector
 	float y;
 	float z;
 
-	FVector(float InX, float InY, float InZ) : x(InX), y(InY), z(InZ) {};
+	constexpr FVector() : x(0), y(0), z(0) {};
+	constexpr FVector(float InX, float InY, float InZ) : x(InX), y(InY), z(InZ) {};
+};
+
+//   ڽ (  Min > Max)
+struct FBox
+{
+	FVector Min = FVector(INFINITY, INFINITY, INFINITY);
+	FVector Max = FVector(-INFINITY, -INFINITY, -INFINITY);
+
+	void Add(const FVector& P)
+	{
+		Min = FVector(min(Min.x, P.x), min(Min.y, P.y), min(Min.z, P.z));
+		Max = FVector(max(Max.x, P.x), max(Max.y, P.y), max(Max.z, P.z));
+	}
+
+	void Add(const FBox& B)
+	{
+		Min = FVector(min(Min.x, B.Min.x), min(Min.y, B.Min.y), min(Min.z, B.Min.z));
+		Max = FVector(max(Max.x, B.Max.x), max(Max.y, B.Max.y), max(Max.z, B.Max.z));
+	}
+
+	bool IsEmpty() const
+	{
+		return Min.x > Max.x || Min.y > Max.y || Min.z > Max.z;
+	}
+
+	FVector Center() const
+	{
+		return FVector((Min.x + Max.x) * 0.5f, (Min.y + Max.y) * 0.5f, (Min.z + Max.z) * 0.5f);
+	}
+
+	// ߽ɿ     
+	FVector Extent() const
+	{
+		return FVector((Max.x - Min.x) * 0.5f, (Max.y - Min.y) * 0.5f, (Max.z - Min.z) * 0.5f);
+	}
+
+	float SurfaceArea() const
+	{
+		if (IsEmpty())
+		{
+			return 0.0f;
+		}
+
+		const float X = Max.x - Min.x, Y = Max.y - Min.y, Z = Max.z - Min.z;
+
+		return 2.0f * (X * Y + Y * Z + Z * X);
+	}
+};
+
+constexpr float Dot(const FVector& A, const FVector& B)
+{
+	return A.x * B.x + A.y * B.y + A.z * B.z;
+}
+
+constexpr FVector Cross(const FVector& A, const FVector& B)
+{
+	return FVector(A.y * B.z - A.z * B.y, A.z * B.x - A.x * B.z, A.x * B.y - A.y * B.x);
+}
+
+inline float GetAxis(const FVector& V, int Axis)
+{
+	return Axis == 0 ? V.x : (Axis == 1 ? V.y : V.z);
+}
+
+// ٿ  (Radius < 0̸  )
+struct FSphere
+{
+	FVector Center;
+	float Radius = -1.0f;
 };
 
 struct FVector2
@@ -32,16 +107,68 @@ struct Vertex
 	FVector Normal;
 };
 
+// źƮ  źƮ (źƮ = BitangentSign * cross(Normal, Direction))
+struct FTangent
+{
+	FVector Direction;
+	float BitangentSign;
+};
+
+//   ϳ (ġ, UV, ) ε (0 ,  -1)
+struct FFaceCorner
+{
+	int32_t Location;
+	int32_t TexCoord;
+	int32_t Normal;
+};
+
+// usemtl / o / g   ġ. FirstTriangle     ̸ 
+struct FFaceRange
+{
+	uint32_t FirstTriangle;
+	FName Name;
+};
+
 struct FStaticMesh
 {
 	vector<FVector> Locations;
 	vector<FVector2> TexCoords;
 	vector<FVector> Normals;
-	vector<vector<FVector>> Faces;
+
+	// ﰢ  Ʈ (3 ﰢ ϳ)
+	vector<FFaceCorner> Corners;
+	//  (ٰ) Corners   ġ
+	vector<uint32_t> FaceOffsets;
+
+	// mtllib    (OBJ    )
+	vector<string> MaterialLibraries;
+	// ù usemtl  ﰢ  (None)
+	vector<FFaceRange> MaterialRanges;
+	vector<FFaceRange> GroupRanges;
+
+	size_t NumTriangles() const
+	{
+		return Corners.size() / 3;
+	}
+};
+
+//    ﰢ   ε  ( ο 1)
+struct FStaticMeshSection
+{
+	FName Material;
+	uint32_t FirstIndex;
+	uint32_t NumIndices;
 };
 
 struct UStaticMesh
 {
 	vector<Vertex> Vertices;
 	vector<int> Indices;
+	vector<FStaticMeshSection> Sections;
+	vector<string> MaterialLibraries;
+	// Vertices   (     )
+	vector<FTangent> Tangents;
+	//   ٿ ڽ/ (ComputeMeshBounds ,    )
+	FBox Bounds;
+	FSphere BoundingSphere;
 };
\ No newline at end of file
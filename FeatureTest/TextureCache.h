@@ -0,0 +1,399 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <future>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "Structs.h"
+#include "NameTable.h"
+#include "MappedFile.h"
+#include "MtlParser.h"
+#include "ThreadPool.h"
+
+enum class ETextureFormat : uint8_t
+{
+	Encoded,	//   ״ (ڴ  )
+	RGBA8,
+};
+
+struct FTexture
+{
+	ETextureFormat Format = ETextureFormat::Encoded;
+	uint32_t Width = 0;
+	uint32_t Height = 0;
+	vector<uint8_t> Data;
+
+	size_t GetSizeBytes() const
+	{
+		return Data.size();
+	}
+};
+
+//  θ ޾ FTexture ä Լ (Ŀ 忡 ȣ). ϸ false (ܸ  з ó)
+using FTextureDecoder = function<bool(const string&, FTexture&)>;
+
+// ⺻ ڴ: ̹ ڴ Ƿ  Ʈ ״ ø
+inline bool LoadTextureFileBytes(const string& Path, FTexture& OutTexture)
+{
+	FMappedFile File;
+
+	if (!File.Open(Path))
+	{
+		return false;
+	}
+
+	OutTexture.Format = ETextureFormat::Encoded;
+	OutTexture.Width = 0;
+	OutTexture.Height = 0;
+	OutTexture.Data.assign(File.Data, File.Data + File.Size);
+
+	return true;
+}
+
+// ĳ ũ⸦    ī (Hits ε  ؽó ٽ û 쵵 )
+struct FTextureCacheStats
+{
+	uint64_t Hits = 0;
+	uint64_t Misses = 0;
+	uint64_t Evictions = 0;
+	uint64_t EvictedBytes = 0;
+	uint64_t FailedLoads = 0;
+	size_t ResidentBytes = 0;
+	size_t PeakResidentBytes = 0;
+	size_t NumTextures = 0;		//  + ε 
+	size_t BudgetBytes = 0;
+};
+
+//  ϳ  ĳ ׸. RefCount/bLoaded/LruIt ĳ ؽ ȿ ٲ
+// Texture Done  ٲ ʰ, ڵ ϳ   Ƿ ڵ鿡   
+struct FTextureEntry
+{
+	FName Path;
+	FTexture Texture;
+	bool bLoaded = false;
+	bool bFailed = false;
+	uint32_t RefCount = 0;
+	bool bInLru = false;
+	list<FName>::iterator LruIt;
+	promise<void> Done;
+	shared_future<void> DoneFuture;
+};
+
+class FTextureCache;
+
+// ؽó ϳ   īƮ ڵ. ڵ  ִ  ؽó  
+// ĳú  Ǿ 
+class FTextureHandle
+{
+public:
+	FTextureHandle() = default;
+	FTextureHandle(const FTextureHandle& Other);
+	FTextureHandle(FTextureHandle&& Other) noexcept;
+	FTextureHandle& operator=(FTextureHandle Other) noexcept;
+	~FTextureHandle();
+
+	void Reset();
+
+	bool IsValid() const
+	{
+		return Entry != nullptr;
+	}
+
+	bool IsReady() const
+	{
+		return Entry && Entry->DoneFuture.wait_for(chrono::seconds(0)) == future_status::ready;
+	}
+
+	// ε    (ϴ  Ǯ  ۾  ó). ϸ nullptr
+	const FTexture* Wait() const;
+
+	FName GetPath() const
+	{
+		return Entry ? Entry->Path : FName();
+	}
+
+private:
+	friend class FTextureCache;
+
+	FTextureHandle(shared_ptr<FTextureEntry> InEntry, FTextureCache* InCache)
+		: Entry(move(InEntry))
+		, Cache(InCache)
+	{
+	}
+
+	shared_ptr<FTextureEntry> Entry;
+	FTextureCache* Cache = nullptr;
+};
+
+// κ   εؼ ϴ ؽó ĳ
+// δ ȭ  FName ؼ Ű , ε  Ǯ 񵿱 
+// ڵ   ؽó LRU Ͽ ,  Ʈ    ͺ 
+// (ڵ  ִ ؽó   ڵ   ʰ ¸ )
+class FTextureCache
+{
+public:
+	explicit FTextureCache(size_t InBudgetBytes, FTextureDecoder InDecoder = LoadTextureFileBytes, FThreadPool& InPool = FThreadPool::Get())
+		: Decoder(move(InDecoder))
+		, Pool(InPool)
+		, BudgetBytes(InBudgetBytes)
+	{
+	}
+
+	~FTextureCache()
+	{
+		WaitAll();
+	}
+
+	FTextureCache(const FTextureCache&) = delete;
+	FTextureCache& operator=(const FTextureCache&) = delete;
+
+	FTextureHandle Request(string_view Path)
+	{
+		const FName Key(filesystem::path(Path).lexically_normal().generic_string());
+		shared_ptr<FTextureEntry> Entry;
+
+		{
+			lock_guard<mutex> Lock(Mutex);
+			auto It = Entries.find(Key);
+
+			if (It != Entries.end())
+			{
+				Stats.Hits++;
+				AddRefLocked(*It->second);
+				return FTextureHandle(It->second, this);
+			}
+
+			Stats.Misses++;
+			Entry = make_shared<FTextureEntry>();
+			Entry->Path = Key;
+			Entry->RefCount = 1;
+			Entry->DoneFuture = Entry->Done.get_future().share();
+			Entries.emplace(Key, Entry);
+		}
+
+		Pool.Submit([this, Entry]() { Load(Entry); });
+
+		return FTextureHandle(Entry, this);
+	}
+
+	//  ϴ ؽó(map_*)  û. δ MTL  ִ ͸ 
+	void RequestMaterialTextures(const MtlMaterial& Material, const filesystem::path& Directory, vector<FTextureHandle>& OutHandles)
+	{
+		for (const string* Map : { &Material.map_Kd, &Material.map_Ks, &Material.map_Ke, &Material.map_Ns, &Material.map_d, &Material.map_Bump })
+		{
+			if (!Map->empty())
+			{
+				OutHandles.push_back(Request((Directory / *Map).generic_string()));
+			}
+		}
+	}
+
+	void SetBudget(size_t InBudgetBytes)
+	{
+		lock_guard<mutex> Lock(Mutex);
+		BudgetBytes = InBudgetBytes;
+		EvictToBudgetLocked();
+	}
+
+	FTextureCacheStats GetStats() const
+	{
+		lock_guard<mutex> Lock(Mutex);
+		FTextureCacheStats Result = Stats;
+		Result.ResidentBytes = ResidentBytes;
+		Result.NumTextures = Entries.size();
+		Result.BudgetBytes = BudgetBytes;
+		return Result;
+	}
+
+	// ε  ؽó    
+	void WaitAll()
+	{
+		vector<shared_future<void>> Pending;
+
+		{
+			lock_guard<mutex> Lock(Mutex);
+
+			for (auto& Pair : Entries)
+			{
+				if (!Pair.second->bLoaded)
+				{
+					Pending.push_back(Pair.second->DoneFuture);
+				}
+			}
+		}
+
+		for (shared_future<void>& Future : Pending)
+		{
+			Pool.Wait(Future);
+		}
+	}
+
+private:
+	friend class FTextureHandle;
+
+	// ڴ ܸ  з ϰ Done ˷ Wait  ʰ 
+	//  ׸ ĳÿ   û  ٽ ε (̹  ڵ  ¸ ״ )
+	void Load(const shared_ptr<FTextureEntry>& Entry)
+	{
+		FTexture Texture;
+		bool bSucceeded = false;
+
+		try
+		{
+			bSucceeded = Decoder(Entry->Path.ToString(), Texture);
+		}
+		catch (...)
+		{
+			bSucceeded = false;
+		}
+
+		if (!bSucceeded)
+		{
+			Texture = FTexture();
+		}
+
+		{
+			lock_guard<mutex> Lock(Mutex);
+
+			Entry->Texture = move(Texture);
+			Entry->bLoaded = true;
+			Entry->bFailed = !bSucceeded;
+
+			if (bSucceeded)
+			{
+				ResidentBytes += Entry->Texture.GetSizeBytes();
+				Stats.PeakResidentBytes = max(Stats.PeakResidentBytes, ResidentBytes);
+
+				// ε ߿ ڵ   ٷ  ĺ
+				if (Entry->RefCount == 0)
+				{
+					PushLruLocked(*Entry);
+				}
+
+				EvictToBudgetLocked();
+			}
+			else
+			{
+				Stats.FailedLoads++;
+				Entries.erase(Entry->Path);
+			}
+		}
+
+		Entry->Done.set_value();
+	}
+
+	void AddRef(FTextureEntry& Entry)
+	{
+		lock_guard<mutex> Lock(Mutex);
+		AddRefLocked(Entry);
+	}
+
+	void Release(FTextureEntry& Entry)
+	{
+		lock_guard<mutex> Lock(Mutex);
+
+		//  ׸ ̹ ĳÿ Ƿ LRU  
+		if (--Entry.RefCount == 0 && Entry.bLoaded && !Entry.bFailed)
+		{
+			PushLruLocked(Entry);
+			EvictToBudgetLocked();
+		}
+	}
+
+	void AddRefLocked(FTextureEntry& Entry)
+	{
+		if (Entry.RefCount++ == 0 && Entry.bInLru)
+		{
+			Lru.erase(Entry.LruIt);
+			Entry.bInLru = false;
+		}
+	}
+
+	//  ֱٿ   
+	void PushLruLocked(FTextureEntry& Entry)
+	{
+		Lru.push_front(Entry.Path);
+		Entry.LruIt = Lru.begin();
+		Entry.bInLru = true;
+	}
+
+	void EvictToBudgetLocked()
+	{
+		while (ResidentBytes > BudgetBytes && !Lru.empty())
+		{
+			auto It = Entries.find(Lru.back());
+			const size_t Bytes = It->second->Texture.GetSizeBytes();
+
+			ResidentBytes -= Bytes;
+			Stats.Evictions++;
+			Stats.EvictedBytes += Bytes;
+
+			Lru.pop_back();
+			Entries.erase(It);
+		}
+	}
+
+	FTextureDecoder Decoder;
+	FThreadPool& Pool;
+
+	mutable mutex Mutex;
+	unordered_map<FName, shared_ptr<FTextureEntry>> Entries;
+	list<FName> Lru;
+	size_t BudgetBytes = 0;
+	size_t ResidentBytes = 0;
+	FTextureCacheStats Stats;
+};
+
+inline FTextureHandle::FTextureHandle(const FTextureHandle& Other)
+	: Entry(Other.Entry)
+	, Cache(Other.Cache)
+{
+	if (Entry)
+	{
+		Cache->AddRef(*Entry);
+	}
+}
+
+inline FTextureHandle::FTextureHandle(FTextureHandle&& Other) noexcept
+	: Entry(move(Other.Entry))
+	, Cache(Other.Cache)
+{
+	Other.Cache = nullptr;
+}
+
+inline FTextureHandle& FTextureHandle::operator=(FTextureHandle Other) noexcept
+{
+	swap(Entry, Other.Entry);
+	swap(Cache, Other.Cache);
+	return *this;
+}
+
+inline FTextureHandle::~FTextureHandle()
+{
+	Reset();
+}
+
+inline void FTextureHandle::Reset()
+{
+	if (Entry)
+	{
+		Cache->Release(*Entry);
+	}
+
+	Entry.reset();
+	Cache = nullptr;
+}
+
+inline const FTexture* FTextureHandle::Wait() const
+{
+	Cache->Pool.Wait(Entry->DoneFuture);
+	return Entry->bFailed ? nullptr : &Entry->Texture;
+}
@@ -0,0 +1,489 @@
+#pragma once
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "Structs.h"
+#include "ThreadPool.h"
+#include "SimdFloat4.h"
+#include "MeshNormals.h"
+#include "MappedFile.h"
+#include "CookedAsset.h"
+#include "TextureCache.h"
+
+// sRGB <->  ȯ ǥ. ڵ Ʈ  ĭ, ڵ   SrgbEncodeSteps ܰ   ĭ
+// (ܰ谡  ߾Ƽ ο   12.92  0.1 LSB )
+constexpr int SrgbEncodeSteps = 16384;
+
+struct FSrgbTables
+{
+	float ToLinear[256];
+	float Unorm[256];
+	uint8_t FromLinear[SrgbEncodeSteps + 1];
+
+	FSrgbTables()
+	{
+		for (int i = 0; i < 256; i++)
+		{
+			const float c = i / 255.0f;
+
+			ToLinear[i] = c <= 0.04045f ? c / 12.92f : powf((c + 0.055f) / 1.055f, 2.4f);
+			Unorm[i] = c;
+		}
+
+		for (int i = 0; i <= SrgbEncodeSteps; i++)
+		{
+			const float l = static_cast<float>(i) / SrgbEncodeSteps;
+			const float c = l <= 0.0031308f ? l * 12.92f : 1.055f * powf(l, 1.0f / 2.4f) - 0.055f;
+
+			FromLinear[i] = static_cast<uint8_t>(min(255.0f, max(0.0f, c * 255.0f + 0.5f)));
+		}
+	}
+
+	static const FSrgbTables& Get()
+	{
+		static const FSrgbTables Tables;
+		return Tables;
+	}
+};
+
+//  ȼ ̺     (۾ ϳ    )
+constexpr size_t MipRowsMinPixelsPerTask = MinElementsPerTask;
+
+// RGBA8  ϳ μ   (2x2 ڽ )
+// Ȧ ũ ()  ڸ /   ؼ   ( ุ 3 ). ũⰡ 1  ״ 1
+// bSRGB      ٽ sRGB ( ), Ĵ ׻  
+// ȼ ϳ RGBA FFloat4   ٷ,   Ǯ  ó
+inline void DownsampleMip(const FTexture& Source, FTexture& OutMip, bool bSRGB, FThreadPool& Pool = FThreadPool::Get())
+{
+	const uint32_t SrcWidth = Source.Width;
+	const uint32_t SrcHeight = Source.Height;
+	const uint32_t Width = max(1u, SrcWidth / 2);
+	const uint32_t Height = max(1u, SrcHeight / 2);
+
+	OutMip.Format = ETextureFormat::RGBA8;
+	OutMip.Width = Width;
+	OutMip.Height = Height;
+	OutMip.Data.resize(static_cast<size_t>(Width) * Height * 4);
+
+	const FSrgbTables& Tables = FSrgbTables::Get();
+	const float* Decode = bSRGB ? Tables.ToLinear : Tables.Unorm;
+	const float ColorScale = bSRGB ? static_cast<float>(SrgbEncodeSteps) : 255.0f;
+	const float ScaleValues[4] = { ColorScale, ColorScale, ColorScale, 255.0f };
+	const FFloat4 Scale = FFloat4::Load(ScaleValues);
+	const FFloat4 Quarter = FFloat4::Splat(0.25f);
+	const FFloat4 Half = FFloat4::Splat(0.5f);
+
+	const uint8_t* Src = Source.Data.data();
+	uint8_t* Dst = OutMip.Data.data();
+
+	auto Load = [&](const uint8_t* p)
+	{
+		const float Values[4] = { Decode[p[0]], Decode[p[1]], Decode[p[2]], Tables.Unorm[p[3]] };
+		return FFloat4::Load(Values);
+	};
+
+	//  ؼ i  ࿡   ؼ  ( 2, Ȧ ũ  ؼ 3,  1̸ 1)
+	auto NumTaps = [](uint32_t i, uint32_t SrcSize, uint32_t Size)
+	{
+		return SrcSize == 1 ? 1u : (i == Size - 1 && (SrcSize & 1)) ? 3u : 2u;
+	};
+
+	const size_t RowsPerTask = max<size_t>(1, MipRowsMinPixelsPerTask / Width);
+
+	ParallelForRanges(Pool, Height, RowsPerTask, [&](size_t Begin, size_t End)
+	{
+		for (size_t y = Begin; y < End; y++)
+		{
+			const uint32_t NumRows = NumTaps(static_cast<uint32_t>(y), SrcHeight, Height);
+			const uint8_t* Row0 = Src + (2 * y) * SrcWidth * 4;
+			uint8_t* Out = Dst + y * Width * 4;
+
+			for (uint32_t x = 0; x < Width; x++)
+			{
+				const uint32_t NumColumns = NumTaps(x, SrcWidth, Width);
+				const size_t x0 = static_cast<size_t>(2 * x) * 4;
+				FFloat4 Average;
+
+				if (NumRows == 2 && NumColumns == 2)
+				{
+					const uint8_t* Row1 = Row0 + SrcWidth * 4;
+					Average = (Load(Row0 + x0) + Load(Row0 + x0 + 4) + Load(Row1 + x0) + Load(Row1 + x0 + 4)) * Quarter;
+				}
+				else
+				{
+					// ڸ ؼ   (  ϳ/ ϳ)
+					FFloat4 Sum = FFloat4::Splat(0.0f);
+
+					for (uint32_t dy = 0; dy < NumRows; dy++)
+					{
+						for (uint32_t dx = 0; dx < NumColumns; dx++)
+						{
+							Sum = Sum + Load(Row0 + dy * SrcWidth * 4 + x0 + dx * 4);
+						}
+					}
+
+					Average = Sum * FFloat4::Splat(1.0f / static_cast<float>(NumRows * NumColumns));
+				}
+
+				float Encoded[4];
+				(Average * Scale + Half).Store(Encoded);
+
+				for (int c = 0; c < 3; c++)
+				{
+					const int i = static_cast<int>(Encoded[c]);
+					Out[x * 4 + c] = bSRGB ? Tables.FromLinear[min(i, SrgbEncodeSteps)] : static_cast<uint8_t>(min(i, 255));
+				}
+
+				Out[x * 4 + 3] = static_cast<uint8_t>(min(static_cast<int>(Encoded[3]), 255));
+			}
+		}
+	});
+}
+
+inline uint32_t GetNumMips(uint32_t Width, uint32_t Height)
+{
+	uint32_t NumMips = 1;
+
+	while ((Width > 1 || Height > 1) && NumMips < 32)
+	{
+		Width = max(1u, Width / 2);
+		Height = max(1u, Height / 2);
+		NumMips++;
+	}
+
+	return NumMips;
+}
+
+// 1x1 ü  ü  (OutMips[0] =  ). Base RGBA8̾ 
+inline bool GenerateMipChain(const FTexture& Base, vector<FTexture>& OutMips, bool bSRGB = true, FThreadPool& Pool = FThreadPool::Get())
+{
+	OutMips.clear();
+
+	if (Base.Format != ETextureFormat::RGBA8 || Base.Width == 0 || Base.Height == 0 || Base.Data.size() != static_cast<size_t>(Base.Width) * Base.Height * 4)
+	{
+		return false;
+	}
+
+	OutMips.resize(GetNumMips(Base.Width, Base.Height));
+	OutMips[0] = Base;
+
+	for (size_t Level = 1; Level < OutMips.size(); Level++)
+	{
+		DownsampleMip(OutMips[Level - 1], OutMips[Level], bSRGB, Pool);
+	}
+
+	return true;
+}
+
+// ȭ鿡 ProjectedPixels ȼ ũ ̴ ؽó ʿ    (ؼ ϳ <= ȼ ϳ)
+inline uint32_t SelectMipForScreenSize(uint32_t Width, uint32_t Height, float ProjectedPixels, uint32_t NumMips)
+{
+	const float Texels = static_cast<float>(max(Width, Height));
+
+	if (ProjectedPixels <= 0.0f)
+	{
+		return NumMips - 1;
+	}
+
+	const int Level = static_cast<int>(floorf(log2f(max(1.0f, Texels / ProjectedPixels))));
+	return min(static_cast<uint32_t>(Level), NumMips - 1);
+}
+
+// ---- ̳ʸ PPM (P6) ----------------------------------------------------------
+// ܺ ڴ    ִ  . FTextureDecoder ٷ    (Ĵ 255)
+
+inline bool LoadPPM(const string& Path, FTexture& OutTexture)
+{
+	FMappedFile File;
+
+	if (!File.Open(Path) || File.Size < 2 || File.Data[0] != 'P' || File.Data[1] != '6')
+	{
+		return false;
+	}
+
+	// : , ʺ, , ִ (̿  # ּ ), ״   ĭ  ȼ
+	const char* p = File.Data + 2;
+	const char* End = File.Data + File.Size;
+	uint32_t Fields[3] = {};
+
+	for (uint32_t& Field : Fields)
+	{
+		while (p < End && (isspace(static_cast<unsigned char>(*p)) || *p == '#'))
+		{
+			if (*p == '#')
+			{
+				while (p < End && *p != '\n')
+				{
+					p++;
+				}
+			}
+			else
+			{
+				p++;
+			}
+		}
+
+		const char* Begin = p;
+
+		while (p < End && *p >= '0' && *p <= '9')
+		{
+			Field = Field * 10 + (*p++ - '0');
+		}
+
+		if (p == Begin)
+		{
+			return false;
+		}
+	}
+
+	const uint32_t Width = Fields[0];
+	const uint32_t Height = Fields[1];
+	const size_t NumPixels = static_cast<size_t>(Width) * Height;
+
+	if (Fields[2] != 255 || p >= End || static_cast<size_t>(End - (p + 1)) < NumPixels * 3)
+	{
+		return false;
+	}
+
+	const uint8_t* Pixels = reinterpret_cast<const uint8_t*>(p + 1);
+
+	OutTexture.Format = ETextureFormat::RGBA8;
+	OutTexture.Width = Width;
+	OutTexture.Height = Height;
+	OutTexture.Data.resize(NumPixels * 4);
+
+	for (size_t i = 0; i < NumPixels; i++)
+	{
+		OutTexture.Data[i * 4 + 0] = Pixels[i * 3 + 0];
+		OutTexture.Data[i * 4 + 1] = Pixels[i * 3 + 1];
+		OutTexture.Data[i * 4 + 2] = Pixels[i * 3 + 2];
+		OutTexture.Data[i * 4 + 3] = 255;
+	}
+
+	return true;
+}
+
+inline bool SavePPM(const string& Path, const FTexture& Texture)
+{
+	if (Texture.Format != ETextureFormat::RGBA8)
+	{
+		return false;
+	}
+
+	ofstream File(Path, ios::binary);
+
+	if (!File)
+	{
+		return false;
+	}
+
+	File << "P6\n" << Texture.Width << " " << Texture.Height << "\n255\n";
+
+	const size_t NumPixels = static_cast<size_t>(Texture.Width) * Texture.Height;
+	vector<uint8_t> Rgb(NumPixels * 3);
+
+	for (size_t i = 0; i < NumPixels; i++)
+	{
+		memcpy(&Rgb[i * 3], &Texture.Data[i * 4], 3);
+	}
+
+	File.write(reinterpret_cast<const char*>(Rgb.data()), Rgb.size());
+
+	return File.good();
+}
+
+// ----  Ʈ ------------------------------------------------------------------
+//  ü : [][ 0][ 1]...    RGBA8̰ CookedAlignment  
+//   Ƿ ʿ  ο о   
+
+constexpr uint32_t CookedMipMagic = 0x50494D55;	// "UMIP"
+constexpr uint32_t MaxCookedMips = 16;			// 32768 x 32768
+
+struct alignas(64) FCookedMipHeader
+{
+	uint32_t Magic;
+	uint32_t Version;
+	uint32_t Width;
+	uint32_t Height;
+	uint32_t NumMips;
+	uint32_t bSRGB;
+	uint64_t LevelOffset[MaxCookedMips];
+};
+
+static_assert(sizeof(FCookedMipHeader) == 3 * CookedAlignment, "ŷ  ũ   CookedVersion ø ");
+
+inline bool SaveMipChain(const string& Path, const vector<FTexture>& Mips, bool bSRGB)
+{
+	if (Mips.empty() || Mips.size() > MaxCookedMips)
+	{
+		return false;
+	}
+
+	FCookedMipHeader Header = {};
+	Header.Magic = CookedMipMagic;
+	Header.Version = CookedVersion;
+	Header.Width = Mips[0].Width;
+	Header.Height = Mips[0].Height;
+	Header.NumMips = static_cast<uint32_t>(Mips.size());
+	Header.bSRGB = bSRGB ? 1 : 0;
+
+	uint64_t Offset = sizeof(FCookedMipHeader);
+
+	for (size_t Level = 0; Level < Mips.size(); Level++)
+	{
+		Header.LevelOffset[Level] = Offset;
+		Offset = AlignCooked(Offset + Mips[Level].Data.size());
+	}
+
+	ofstream File(Path, ios::binary);
+
+	if (!File)
+	{
+		return false;
+	}
+
+	File.write(reinterpret_cast<const char*>(&Header), sizeof(Header));
+
+	const char Padding[CookedAlignment] = {};
+
+	for (size_t Level = 0; Level < Mips.size(); Level++)
+	{
+		const size_t Size = Mips[Level].Data.size();
+
+		File.write(reinterpret_cast<const char*>(Mips[Level].Data.data()), Size);
+		File.write(Padding, AlignCooked(Size) - Size);
+	}
+
+	return File.good();
+}
+
+//  ü   ΰ û     ֽŰ ؽó
+//     ʿ ׶ ο  , ־   
+class FStreamedTexture
+{
+public:
+	bool Open(const string& Path)
+	{
+		Levels.clear();
+		FirstResidentMip = 0;
+
+		if (!File.Open(Path) || File.Size < sizeof(FCookedMipHeader))
+		{
+			File.Close();
+			return false;
+		}
+
+		Header = reinterpret_cast<const FCookedMipHeader*>(File.Data);
+		bool bValid = Header->Magic == CookedMipMagic && Header->Version == CookedVersion && Header->NumMips >= 1 && Header->NumMips <= MaxCookedMips;
+
+		for (uint32_t Level = 0; bValid && Level < Header->NumMips; Level++)
+		{
+			bValid = Header->LevelOffset[Level] + GetMipSizeBytes(Level) <= File.Size;
+		}
+
+		if (!bValid)
+		{
+			File.Close();
+			Header = nullptr;
+			return false;
+		}
+
+		Levels.resize(Header->NumMips);
+		FirstResidentMip = Header->NumMips;
+
+		return true;
+	}
+
+	// FirstMip    ֽŴ (  о , FirstMip   )
+	void RequestMips(uint32_t FirstMip)
+	{
+		if (Header == nullptr)
+		{
+			return;
+		}
+
+		FirstMip = min(FirstMip, Header->NumMips - 1);
+
+		for (uint32_t Level = 0; Level < Header->NumMips; Level++)
+		{
+			FTexture& Mip = Levels[Level];
+
+			if (Level < FirstMip)
+			{
+				Mip = FTexture();
+			}
+			else if (Mip.Data.empty())
+			{
+				const uint8_t* Source = reinterpret_cast<const uint8_t*>(File.Data + Header->LevelOffset[Level]);
+
+				Mip.Format = ETextureFormat::RGBA8;
+				Mip.Width = GetMipWidth(Level);
+				Mip.Height = GetMipHeight(Level);
+				Mip.Data.assign(Source, Source + GetMipSizeBytes(Level));
+			}
+		}
+
+		FirstResidentMip = FirstMip;
+	}
+
+	//  ʴ ̸ nullptr
+	const FTexture* GetMip(uint32_t Level) const
+	{
+		return Level >= FirstResidentMip && Level < Levels.size() ? &Levels[Level] : nullptr;
+	}
+
+	uint32_t GetFirstResidentMip() const
+	{
+		return FirstResidentMip;
+	}
+
+	size_t GetResidentBytes() const
+	{
+		size_t Bytes = 0;
+
+		for (const FTexture& Mip : Levels)
+		{
+			Bytes += Mip.GetSizeBytes();
+		}
+
+		return Bytes;
+	}
+
+	size_t GetFullChainBytes() const
+	{
+		size_t Bytes = 0;
+
+		for (uint32_t Level = 0; Header && Level < Header->NumMips; Level++)
+		{
+			Bytes += GetMipSizeBytes(Level);
+		}
+
+		return Bytes;
+	}
+
+	uint32_t GetNumMips() const { return Header ? Header->NumMips : 0; }
+	uint32_t GetWidth() const { return Header ? Header->Width : 0; }
+	uint32_t GetHeight() const { return Header ? Header->Height : 0; }
+	bool IsSRGB() const { return Header && Header->bSRGB != 0; }
+
+private:
+	uint32_t GetMipWidth(uint32_t Level) const { return max(1u, Header->Width >> Level); }
+	uint32_t GetMipHeight(uint32_t Level) const { return max(1u, Header->Height >> Level); }
+
+	size_t GetMipSizeBytes(uint32_t Level) const
+	{
+		return static_cast<size_t>(GetMipWidth(Level)) * GetMipHeight(Level) * 4;
+	}
+
+	FMappedFile File;
+	const FCookedMipHeader* Header = nullptr;
+	vector<FTexture> Levels;
+	uint32_t FirstResidentMip = 0;
+};
@@ -0,0 +1,266 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// Ŀ ۾  δ work-stealing  Ǯ
+// Ŀ  ۾ ڱ  ڿ װ(LIFO),    ٸ Ŀ  տ  (FIFO)
+// Ǯ ȿ ٸ ۾ ٸ  Wait ϴ   ۾   (ø ParallelFor  )
+class FThreadPool
+{
+public:
+	explicit FThreadPool(size_t NumThreads = std::max(1u, std::thread::hardware_concurrency()))
+	{
+		for (size_t i = 0; i < NumThreads; i++)
+		{
+			Queues.push_back(std::make_unique<FWorkerQueue>());
+		}
+
+		for (size_t i = 0; i < NumThreads; i++)
+		{
+			Workers.emplace_back([this, i]() { WorkerLoop(i); });
+		}
+	}
+
+	~FThreadPool()
+	{
+		{
+			std::lock_guard<std::mutex> Lock(SleepMutex);
+			bStop = true;
+		}
+
+		SleepCondition.notify_all();
+
+		for (std::thread& Worker : Workers)
+		{
+			Worker.join();
+		}
+	}
+
+	FThreadPool(const FThreadPool&) = delete;
+	FThreadPool& operator=(const FThreadPool&) = delete;
+
+	// ۾     future ȯ
+	template<typename F>
+	auto Submit(F&& Task) -> std::future<std::invoke_result_t<std::decay_t<F>>>
+	{
+		using ResultType = std::invoke_result_t<std::decay_t<F>>;
+
+		// std::function  ؾ ϹǷ packaged_task shared_ptr 
+		auto Packaged = std::make_shared<std::packaged_task<ResultType()>>(std::forward<F>(Task));
+		std::future<ResultType> Result = Packaged->get_future();
+
+		// Ŀ 忡 ϸ ڱ , ܺο ϸ ư鼭 й
+		const size_t QueueIndex = (CurrentPool == this) ? CurrentWorker : NextQueue.fetch_add(1, std::memory_order_relaxed) % Queues.size();
+
+		//  ֱ    ( ڿ   ̿ ٸ Ŀ 鼭  īͰ 0 Ʒ )
+		{
+			std::lock_guard<std::mutex> Lock(SleepMutex);
+			PendingTasks++;
+		}
+
+		try
+		{
+			std::lock_guard<std::mutex> Lock(Queues[QueueIndex]->Mutex);
+			Queues[QueueIndex]->Tasks.emplace_back([Packaged]() { (*Packaged)(); });
+		}
+		catch (...)
+		{
+			PendingTasks--;
+			throw;
+		}
+
+		SleepCondition.notify_one();
+
+		return Result;
+	}
+
+	//  ۾ ϳ  忡  ( false)
+	bool TryRunPendingTask()
+	{
+		std::function<void()> Task;
+		const size_t Home = (CurrentPool == this) ? CurrentWorker : 0;
+
+		if (!PopTask(Home, Task))
+		{
+			return false;
+		}
+
+		Task();
+
+		return true;
+	}
+
+	// future(shared_future) غ  ٸ ۾  óϸ鼭 
+	template<typename TFuture>
+	decltype(auto) Wait(TFuture& Future)
+	{
+		while (Future.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+		{
+			if (!TryRunPendingTask())
+			{
+				Future.wait_for(std::chrono::microseconds(50));
+			}
+		}
+
+		return Future.get();
+	}
+
+	size_t Num() const
+	{
+		return Workers.size();
+	}
+
+	// μ  ϴ ⺻ Ǯ
+	static FThreadPool& Get()
+	{
+		static FThreadPool Pool;
+		return Pool;
+	}
+
+private:
+	struct FWorkerQueue
+	{
+		std::mutex Mutex;
+		std::deque<std::function<void()>> Tasks;
+	};
+
+	// ڱ  ڿ  ,   ٸ  տ ħ
+	bool PopTask(size_t Home, std::function<void()>& OutTask)
+	{
+		{
+			FWorkerQueue& Own = *Queues[Home];
+			std::lock_guard<std::mutex> Lock(Own.Mutex);
+
+			if (!Own.Tasks.empty())
+			{
+				OutTask = std::move(Own.Tasks.back());
+				Own.Tasks.pop_back();
+				PendingTasks--;
+				return true;
+			}
+		}
+
+		for (size_t Offset = 1; Offset < Queues.size(); Offset++)
+		{
+			FWorkerQueue& Victim = *Queues[(Home + Offset) % Queues.size()];
+			std::lock_guard<std::mutex> Lock(Victim.Mutex);
+
+			if (!Victim.Tasks.empty())
+			{
+				OutTask = std::move(Victim.Tasks.front());
+				Victim.Tasks.pop_front();
+				PendingTasks--;
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	void WorkerLoop(size_t Index)
+	{
+		CurrentPool = this;
+		CurrentWorker = Index;
+
+		while (true)
+		{
+			std::function<void()> Task;
+
+			if (PopTask(Index, Task))
+			{
+				Task();
+				continue;
+			}
+
+			std::unique_lock<std::mutex> Lock(SleepMutex);
+			SleepCondition.wait(Lock, [this]() { return bStop || PendingTasks > 0; });
+
+			if (bStop && PendingTasks == 0)
+			{
+				return;
+			}
+		}
+	}
+
+	std::vector<std::unique_ptr<FWorkerQueue>> Queues;
+	std::vector<std::thread> Workers;
+	std::atomic<size_t> NextQueue{ 0 };
+	std::atomic<size_t> PendingTasks{ 0 };
+	std::mutex SleepMutex;
+	std::condition_variable SleepCondition;
+	bool bStop = false;
+
+	static inline thread_local FThreadPool* CurrentPool = nullptr;
+	static inline thread_local size_t CurrentWorker = 0;
+};
+
+// [0, Count)  Ǯ  ϰ     ( ߿  ۾  ó)
+// ܰ  ٸ ۾ Body ϰ Ƿ   ڿ ù ° ܸ ٽ 
+template<typename F>
+void ParallelFor(FThreadPool& Pool, size_t Count, F&& Body)
+{
+	if (Count == 0)
+	{
+		return;
+	}
+
+	if (Count == 1)
+	{
+		Body(size_t(0));
+		return;
+	}
+
+	std::vector<std::future<void>> Pending;
+	Pending.reserve(Count);
+
+	for (size_t i = 0; i < Count; i++)
+	{
+		Pending.push_back(Pool.Submit([&Body, i]() { Body(i); }));
+	}
+
+	std::exception_ptr FirstException;
+
+	for (std::future<void>& Future : Pending)
+	{
+		try
+		{
+			Pool.Wait(Future);
+		}
+		catch (...)
+		{
+			if (!FirstException)
+			{
+				FirstException = std::current_exception();
+			}
+		}
+	}
+
+	if (FirstException)
+	{
+		std::rethrow_exception(FirstException);
+	}
+}
+
+// [0, Count)     Body(Begin, End)   ( ϳ MinRange ̻)
+template<typename F>
+void ParallelForRanges(FThreadPool& Pool, size_t Count, size_t MinRange, F&& Body)
+{
+	const size_t NumRanges = std::max<size_t>(1, std::min(Pool.Num() * 4, Count / std::max<size_t>(1, MinRange)));
+
+	ParallelFor(Pool, NumRanges, [&](size_t r)
+	{
+		Body(Count * r / NumRanges, Count * (r + 1) / NumRanges);
+	});
+}
@@ -1,28 +1,194 @@
+#include <charconv>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <random>
+#include <stdexcept>
+#include <string_view>
+#include <unordered_map>
+
 #include "Structs.h"
+#include "MappedFile.h"
+#include "CookedAsset.h"
+#include "ThreadPool.h"
+#include "VertexDedupMap.h"
+#include "SpillArray.h"
+#include "MeshOptimizer.h"
+#include "MeshQuantize.h"
+#include "AssetLoader.h"
+#include "MaterialLibrary.h"
+#include "MeshNormals.h"
+#include "MeshSimplify.h"
+#include "MeshBVH.h"
+#include "MeshBounds.h"
+#include "MeshCulling.h"
+#include "TextureCache.h"
+#include "TextureMips.h"
+#include "MeshTransform.h"
+
+// () ε  ﰢ : ûũ    ûũ ŭ 
+struct FRelativeCorner
+{
+	uint32_t Corner;
+	uint8_t ComponentMask;	// 1 = ġ, 2 = UV, 4 = 
+};
+
+//  Ľ  ûũ ϳ  (ε ûũ  )
+struct FOBJChunk
+{
+	FStaticMesh Mesh;
+	vector<FRelativeCorner> RelativeCorners;
+};
+
+// Ʈ Ʈ  (MemoryBudget ȿ б , ġ, v/vt/vn  ĳø  )
+struct FOBJStreamOptions
+{
+	size_t MemoryBudget = 64 << 20;
+	string SpillDirectory = ".";
+};
+
+// ũ Ѱ ϼ ġ (ε ġ   , ġ   )
+struct FMeshBatch
+{
+	const Vertex* Vertices;
+	size_t NumVertices;
+	const int* Indices;
+	size_t NumIndices;
+	size_t BatchIndex;
+};
+
+using FMeshBatchSink = function<void(const FMeshBatch&)>;
+
+struct FOBJStreamStats
+{
+	size_t NumBatches = 0;
+	size_t NumVertices = 0;
+	size_t NumIndices = 0;
+	size_t SpilledBytes = 0;
+	size_t PeakResidentBytes = 0;
+};
 
 void ParseOBJ(const string& filename, FStaticMesh& OutFStaticMesh);
-FVector ParseFaceVertex(const string& VertexData);
-void Triangulate(const vector<FVector>& InFace, vector<vector<FVector>>& OutFaces);
-void BuildStaticMesh(const FStaticMesh& InFStaticMesh, UStaticMesh& OutUStaticMesh);
+void ParseOBJMapped(const string& filename, FStaticMesh& OutFStaticMesh);
+void ParseOBJParallel(const string& filename, FStaticMesh& OutFStaticMesh, FThreadPool& Pool = FThreadPool::Get());
+void ParseOBJBuffer(const char* Begin, const char* End, FStaticMesh& OutFStaticMesh, vector<FRelativeCorner>* OutRelativeCorners = nullptr);
+void MergeOBJChunks(vector<FOBJChunk>& Chunks, FStaticMesh& OutFStaticMesh, FThreadPool& Pool);
+FFaceCorner ParseFaceVertex(const string& VertexData, const FStaticMesh& InFStaticMesh);
+FFaceCorner ParseFaceVertex(string_view VertexData, const size_t (&Counts)[3], uint8_t& OutRelativeMask);
+bool StreamOBJ(const string& filename, const FOBJStreamOptions& Options, const FMeshBatchSink& Sink, FOBJStreamStats* OutStats = nullptr);
+void AddFace(const FFaceCorner* InFace, size_t NumCorners, FStaticMesh& OutFStaticMesh);
+void Triangulate(const FFaceCorner* InFace, size_t NumCorners, vector<FFaceCorner>& OutCorners);
+void AddFaceRange(vector<FFaceRange>& OutRanges, size_t FirstTriangle, FName Name);
+void AddMaterialLibrary(vector<string>& OutLibraries, const string& filename);
+void SortTrianglesByMaterial(const FStaticMesh& InFStaticMesh, vector<uint32_t>& OutTriangleOrder, vector<FStaticMeshSection>& OutSections);
+bool BuildStaticMesh(const FStaticMesh& InFStaticMesh, UStaticMesh& OutUStaticMesh);
+void BuildStaticMeshLegacy(const FStaticMesh& InFStaticMesh, UStaticMesh& OutUStaticMesh);
 void ShowUSMInfo(const UStaticMesh& InUStaticMesh);
+bool LoadStaticMesh(const string& filename, UStaticMesh& OutUStaticMesh, bool bOptimize = false);
+bool LoadMaterials(const string& filename, vector<MtlMaterial>& OutMaterials);
+bool ResolveMaterials(const string& filename, const UStaticMesh& InUStaticMesh, FMaterialLibrary& OutLibrary);
+void ShowSectionInfo(const string& filename);
+void LoadAssetSet();
+FMeshLoadStages MakeOBJLoadStages(bool bOptimize, FThreadPool& Pool = FThreadPool::Get());
+void ShowLoaderInfo(const string& Directory);
+void ShowStreamInfo(const string& filename, const FOBJStreamOptions& Options);
+void ShowSpillFailureInfo(const string& filename);
+void ShowOptimizeInfo(UStaticMesh& InOutUStaticMesh);
+void ShowCompactInfo(const UStaticMesh& InUStaticMesh);
+void ShowNormalInfo(const string& filename);
+void ShowSmoothingSplitInfo(const string& filename);
+void ShowLODInfo(const UStaticMesh& InUStaticMesh, bool bReducible = true);
+void ShowBVHInfo(const UStaticMesh& InUStaticMesh);
+void ShowCullingInfo(const UStaticMesh& InUStaticMesh, size_t NumInstances);
+void ShowTextureCacheInfo(const string& Directory);
+void ShowMipInfo(uint32_t Size);
+void ShowTransformInfo(const UStaticMesh& InUStaticMesh);
+bool IsSameFStaticMesh(const FStaticMesh& A, const FStaticMesh& B);
+bool IsSameUStaticMesh(const UStaticMesh& A, const UStaticMesh& B);
+void CompareParseThroughput(const string& filename);
+void CompareBuildThroughput(const FStaticMesh& InFStaticMesh);
 
 int main()
 {
-	FStaticMesh FSM1, FSM2, FSM3;
-	UStaticMesh USM1, USM2, USM3;
+	//  ޽ø Ѳ ûؼ  ٸ ھ  ε
+	FMeshLoader Loader(MakeOBJLoadStages(false));
 
-	ParseOBJ("Data/cube-tex.obj", FSM1);
-	BuildStaticMesh(FSM1, USM1);
-	ShowUSMInfo(USM1);
+	FMeshLoadHandle Handle1 = Loader.Request("Data/cube-tex.obj");
+	FMeshLoadHandle Handle2 = Loader.Request("Data/bitten_apple_mid.obj");
+	FMeshLoadHandle Handle3 = Loader.Request("Data/apple_mid.obj");
 
-	ParseOBJ("Data/bitten_apple_mid.obj", FSM2);
-	BuildStaticMesh(FSM2, USM2);
-	ShowUSMInfo(USM2);
+	UStaticMesh& USM1 = Handle1.Wait();
+	UStaticMesh& USM2 = Handle2.Wait();
+	UStaticMesh& USM3 = Handle3.Wait();
 
-	ParseOBJ("Data/apple_mid.obj", FSM3);
-	BuildStaticMesh(FSM3, USM3);
+	ShowUSMInfo(USM1);
+	ShowUSMInfo(USM2);
 	ShowUSMInfo(USM3);
 
+	// ׷츶     ϳ ƴ Ȯ
+	ShowSectionInfo("Data/multi-material.obj");
+
+	CompareParseThroughput("Data/bitten_apple_mid.obj");
+	CompareParseThroughput("Data/apple_mid.obj");
+
+	FStaticMesh FSM2, FSM3;
+
+	ParseOBJMapped("Data/bitten_apple_mid.obj", FSM2);
+	ParseOBJMapped("Data/apple_mid.obj", FSM3);
+
+	CompareBuildThroughput(FSM2);
+	CompareBuildThroughput(FSM3);
+
+	ShowOptimizeInfo(USM2);
+	ShowOptimizeInfo(USM3);
+
+	ShowCompactInfo(USM1);
+	ShowCompactInfo(USM2);
+	ShowCompactInfo(USM3);
+
+	// vn  ޽ÿ /źƮ ؼ   
+	ShowNormalInfo("Data/apple_mid.obj");
+	ShowSmoothingSplitInfo("Data/multi-material.obj");
+
+	// Ÿ LOD ü:  ﰢ  ,  ð Ȯ
+	// ť  (鸶 ٸ )     Ƿ  ״ ƾ 
+	ShowLODInfo(USM3);
+	ShowLODInfo(Handle1.Wait(), false);
+
+	// BVH  ð /ֱ  ӵ,  ˻   Ȯ
+	ShowBVHInfo(USM3);
+
+	// νϽ 13  ڷ  ü ø ð Į ˻  
+	ShowCullingInfo(USM3, 512 * 256);
+
+	//   纻 :  Ʈ ȯ ӵ memcpy ϰ Į  
+	ShowTransformInfo(USM3);
+
+	//  ϴ ؽó ĳ÷ ϰ,    ͺ  Ȯ
+	ShowTextureCacheInfo("Data");
+
+	// 2K ؽó  ü  ð,   , Ÿ ʿ Ӹ ֽ  ޸ Ȯ
+	ShowMipInfo(2048);
+
+	// ù  ŷ,  °ʹ ŷ  ؼ ε
+	LoadAssetSet();
+	LoadAssetSet();
+
+	//  ü  ε  ε  о 
+	ShowLoaderInfo("Data");
+
+	// ޸  ٲ㵵 ִ  ޸𸮰  ȿ ӹ Ȯ
+	FOBJStreamOptions StreamOptions;
+
+	StreamOptions.MemoryBudget = 4 << 20;
+	ShowStreamInfo("Data/apple_mid.obj", StreamOptions);
+
+	StreamOptions.MemoryBudget = 16 << 20;
+	ShowStreamInfo("Data/apple_mid.obj", StreamOptions);
+
+	// ӽ       ѱ ʰ и ִ Ȯ
+	ShowSpillFailureInfo("Data/apple_mid.obj");
+
 	return 0;
 }
 
@@ -81,16 +247,34 @@ void ParseOBJ(const string& filename, FStaticMesh& OutFStaticMesh)
 		}
 		else if (type == "f")
 		{
-			vector<FVector> Face;
-			vector<vector<FVector>> Faces;
+			vector<FFaceCorner> Face;
 			string vertexData;
 
 			while (ss >> vertexData) {
-				FVector FaceVertex = ParseFaceVertex(vertexData);
+				FFaceCorner FaceVertex = ParseFaceVertex(vertexData, OutFStaticMesh);
 				Face.push_back(FaceVertex);
 			}
 
-			Triangulate(Face, OutFStaticMesh.Faces);
+			AddFace(Face.data(), Face.size(), OutFStaticMesh);
+		}
+		else if (type == "usemtl" || type == "o" || type == "g")
+		{
+			string name;
+
+			getline(ss, name);
+			trim(name);
+
+			vector<FFaceRange>& Ranges = (type == "usemtl") ? OutFStaticMesh.MaterialRanges : OutFStaticMesh.GroupRanges;
+			AddFaceRange(Ranges, OutFStaticMesh.NumTriangles(), FName(name));
+		}
+		else if (type == "mtllib")
+		{
+			string library;
+
+			while (ss >> library)
+			{
+				AddMaterialLibrary(OutFStaticMesh.MaterialLibraries, library);
+			}
 		}
 	}
 
@@ -98,145 +282,2527 @@ void ParseOBJ(const string& filename, FStaticMesh& OutFStaticMesh)
 	std::cout << " : " << OutFStaticMesh.Locations.size() << "" << std::endl;
 	std::cout << " ؽó ǥ: " << OutFStaticMesh.TexCoords.size() << "" << std::endl;
 	std::cout << " : " << OutFStaticMesh.Normals.size() << "" << std::endl;
-	std::cout << " ﰢ: " << OutFStaticMesh.Faces.size() << "" << std::endl;
+	std::cout << " ﰢ: " << OutFStaticMesh.NumTriangles() << "" << std::endl;
 }
 
-FVector ParseFaceVertex(const string& VertexData)
+//  ° ؼ   Ҵ  Ľ ( ParseOBJ , ٸ  )
+void ParseOBJMapped(const string& filename, FStaticMesh& OutFStaticMesh)
 {
-	FVector fv = { -1, -1, -1 };
+	FMappedFile File;
 
-	std::stringstream ss(VertexData);
-	std::string token;
-	int index = 0;
+	if (!File.Open(filename))
+	{
+		cout << "Can't open file!" << endl;
+		return;
+	}
 
-	// "/"  и: "1/2/3" -> "1", "2", "3"
-	while (std::getline(ss, token, '/'))
+	ParseOBJBuffer(File.Data, File.Data + File.Size, OutFStaticMesh);
+}
+
+//      ûũ  Ľ    (  Ľ̰ Ʈ  )
+void ParseOBJParallel(const string& filename, FStaticMesh& OutFStaticMesh, FThreadPool& Pool)
+{
+	FMappedFile File;
+
+	if (!File.Open(filename))
 	{
-		if (!token.empty()) 
+		cout << "Can't open file!" << endl;
+		return;
+	}
+
+	// ûũ ʹ   ȯ   ũǷ ּ ũ⸦ 
+	const size_t MinChunkBytes = 1 << 20;
+	const size_t ChunkCount = max<size_t>(1, min(Pool.Num() * 4, File.Size / MinChunkBytes));
+
+	vector<const char*> Bounds(ChunkCount + 1);
+	Bounds[0] = File.Data;
+	Bounds[ChunkCount] = File.Data + File.Size;
+
+	for (size_t i = 1; i < ChunkCount; i++)
+	{
+		const char* Target = max(Bounds[i - 1], File.Data + File.Size * i / ChunkCount);
+		const char* NewLine = static_cast<const char*>(memchr(Target, '\n', Bounds[ChunkCount] - Target));
+
+		Bounds[i] = NewLine ? NewLine + 1 : Bounds[ChunkCount];
+	}
+
+	vector<FOBJChunk> Chunks(ChunkCount);
+
+	ParallelFor(Pool, ChunkCount, [&](size_t i)
+	{
+		ParseOBJBuffer(Bounds[i], Bounds[i + 1], Chunks[i].Mesh, &Chunks[i].RelativeCorners);
+	});
+
+	MergeOBJChunks(Chunks, OutFStaticMesh, Pool);
+}
+
+// ûũ    ̾ ̰,  ε  ûũ  ŭ 
+void MergeOBJChunks(vector<FOBJChunk>& Chunks, FStaticMesh& OutFStaticMesh, FThreadPool& Pool)
+{
+	const size_t ChunkCount = Chunks.size();
+
+	//  ûũ  ġ ( )
+	vector<size_t> LocationBase(ChunkCount + 1, OutFStaticMesh.Locations.size());
+	vector<size_t> TexCoordBase(ChunkCount + 1, OutFStaticMesh.TexCoords.size());
+	vector<size_t> NormalBase(ChunkCount + 1, OutFStaticMesh.Normals.size());
+	vector<size_t> CornerBase(ChunkCount + 1, OutFStaticMesh.Corners.size());
+	vector<size_t> FaceBase(ChunkCount + 1, OutFStaticMesh.FaceOffsets.size());
+
+	for (size_t i = 0; i < ChunkCount; i++)
+	{
+		LocationBase[i + 1] = LocationBase[i] + Chunks[i].Mesh.Locations.size();
+		TexCoordBase[i + 1] = TexCoordBase[i] + Chunks[i].Mesh.TexCoords.size();
+		NormalBase[i + 1] = NormalBase[i] + Chunks[i].Mesh.Normals.size();
+		CornerBase[i + 1] = CornerBase[i] + Chunks[i].Mesh.Corners.size();
+		FaceBase[i + 1] = FaceBase[i] + Chunks[i].Mesh.FaceOffsets.size();
+	}
+
+	OutFStaticMesh.Locations.resize(LocationBase[ChunkCount]);
+	OutFStaticMesh.TexCoords.resize(TexCoordBase[ChunkCount]);
+	OutFStaticMesh.Normals.resize(NormalBase[ChunkCount]);
+	OutFStaticMesh.Corners.resize(CornerBase[ChunkCount]);
+	OutFStaticMesh.FaceOffsets.resize(FaceBase[ChunkCount]);
+
+	// /׷  mtllib  Ƿ ûũ  ̾ 
+	// ûũ պκ usemtl  ﰢ  Ƿ  ûũ   ״ ̾
+	for (size_t i = 0; i < ChunkCount; i++)
+	{
+		const FStaticMesh& Mesh = Chunks[i].Mesh;
+		const size_t TriangleBase = CornerBase[i] / 3;
+
+		for (const FFaceRange& Range : Mesh.MaterialRanges)
 		{
-			// 0 ϵ ȯ
-			int value = std::stoi(token);
+			AddFaceRange(OutFStaticMesh.MaterialRanges, TriangleBase + Range.FirstTriangle, Range.Name);
+		}
 
-			if (index == 0)
-			{ 
-				fv.x = value - 1;
+		for (const FFaceRange& Range : Mesh.GroupRanges)
+		{
+			AddFaceRange(OutFStaticMesh.GroupRanges, TriangleBase + Range.FirstTriangle, Range.Name);
+		}
+
+		for (const string& Library : Mesh.MaterialLibraries)
+		{
+			AddMaterialLibrary(OutFStaticMesh.MaterialLibraries, Library);
+		}
+	}
+
+	ParallelFor(Pool, ChunkCount, [&](size_t i)
+	{
+		FStaticMesh& Mesh = Chunks[i].Mesh;
+
+		copy(Mesh.Locations.begin(), Mesh.Locations.end(), OutFStaticMesh.Locations.begin() + LocationBase[i]);
+		copy(Mesh.TexCoords.begin(), Mesh.TexCoords.end(), OutFStaticMesh.TexCoords.begin() + TexCoordBase[i]);
+		copy(Mesh.Normals.begin(), Mesh.Normals.end(), OutFStaticMesh.Normals.begin() + NormalBase[i]);
+
+		for (const FRelativeCorner& Relative : Chunks[i].RelativeCorners)
+		{
+			FFaceCorner& Corner = Mesh.Corners[Relative.Corner];
+
+			if (Relative.ComponentMask & 1)
+			{
+				Corner.Location += static_cast<int32_t>(LocationBase[i]);
 			}
-			else if (index == 1)
+
+			if (Relative.ComponentMask & 2)
 			{
-				fv.y = value - 1;
+				Corner.TexCoord += static_cast<int32_t>(TexCoordBase[i]);
 			}
-			else if (index == 2)
-			{ 
-				fv.z = value - 1;
+
+			if (Relative.ComponentMask & 4)
+			{
+				Corner.Normal += static_cast<int32_t>(NormalBase[i]);
 			}
 		}
-		index++;
-	}
 
-	return fv;
+		copy(Mesh.Corners.begin(), Mesh.Corners.end(), OutFStaticMesh.Corners.begin() + CornerBase[i]);
+
+		for (size_t f = 0; f < Mesh.FaceOffsets.size(); f++)
+		{
+			OutFStaticMesh.FaceOffsets[FaceBase[i] + f] = Mesh.FaceOffsets[f] + static_cast<uint32_t>(CornerBase[i]);
+		}
+
+		Mesh = FStaticMesh();
+	});
 }
 
-void Triangulate(const vector<FVector>& InFace, vector<vector<FVector>>& OutFaces)
+static inline bool IsBlank(char c)
 {
-	// ּ 3  ʿ
-	if (InFace.size() < 3)
+	return c == ' ' || c == '\t' || c == '\r';
+}
+
+static inline const char* SkipBlanks(const char* p, const char* End)
+{
+	while (p < End && IsBlank(*p))
 	{
-		return;
+		p++;
 	}
 
-	// ̹ ﰢ̸ ״ ߰
-	if (InFace.size() == 3)
+	return p;
+}
+
+static inline const char* ParseFloatToken(const char* p, const char* End, float& OutValue)
+{
+	p = SkipBlanks(p, End);
+
+	// from_chars '+' ȣ  Ƿ  ǳʶ (operator>> ϰ ó)
+	if (p < End && *p == '+')
 	{
-		OutFaces.push_back(InFace);
-		return;
+		p++;
 	}
 
-	// Fan Triangulation: ù °  ߽ ﰢ 
-	// : [v0, v1, v2, v3] -> [v0,v1,v2], [v0,v2,v3]
-	for (size_t i = 1; i < InFace.size() - 1; i++) {
-		vector<FVector> triangle;
-		triangle.push_back(InFace[0]);      // ù °  (߽)
-		triangle.push_back(InFace[i]);      //  
-		triangle.push_back(InFace[i + 1]);  //  
-		OutFaces.push_back(triangle);
+	return from_chars(p, End, OutValue).ptr;
+}
+
+//   ü յ 鸸  κ (/׷ ̸    )
+static inline string_view RestOfLine(const char* p, const char* LineEnd)
+{
+	p = SkipBlanks(p, LineEnd);
+
+	while (LineEnd > p && IsBlank(LineEnd[-1]))
+	{
+		LineEnd--;
 	}
+
+	return string_view(p, LineEnd - p);
 }
 
-void BuildStaticMesh(const FStaticMesh& InFStaticMesh, UStaticMesh& OutUStaticMesh)
+// OutRelativeCorners   ε    (ûũ   )
+void ParseOBJBuffer(const char* Begin, const char* End, FStaticMesh& OutFStaticMesh, vector<FRelativeCorner>* OutRelativeCorners)
 {
-	map<string, int> VertexMap;
+	//   ۴  (ٸ  Ҵ )
+	vector<FFaceCorner> Face;
+	vector<uint8_t> FaceRelativeMasks;
+	const char* LineBegin = Begin;
 
-	OutUStaticMesh.Vertices.clear();
-	OutUStaticMesh.Indices.clear();
-		
-	for (const auto& Triangle : InFStaticMesh.Faces)
+	while (LineBegin < End)
 	{
-		for (const auto& FaceVertex : Triangle)
+		const char* LineEnd = static_cast<const char*>(memchr(LineBegin, '\n', End - LineBegin));
+
+		if (LineEnd == nullptr)
 		{
-			string key = to_string((int)FaceVertex.x) + "/" + to_string((int)FaceVertex.y) + "/" + to_string((int)FaceVertex.z);
+			LineEnd = End;
+		}
 
-			auto it = VertexMap.find(key);
+		const char* p = SkipBlanks(LineBegin, LineEnd);
+		const char* TypeBegin = p;
 
-			if (it != VertexMap.end())
-			{
-				OutUStaticMesh.Indices.push_back(it->second);
-			}
-			else
+		while (p < LineEnd && !IsBlank(*p))
+		{
+			p++;
+		}
+
+		string_view Type(TypeBegin, p - TypeBegin);
+
+		if (Type == "v")
+		{
+			FVector v;
+
+			p = ParseFloatToken(p, LineEnd, v.x);
+			p = ParseFloatToken(p, LineEnd, v.y);
+			ParseFloatToken(p, LineEnd, v.z);
+			OutFStaticMesh.Locations.push_back(v);
+		}
+		else if (Type == "vt")
+		{
+			FVector2 vt;
+
+			p = ParseFloatToken(p, LineEnd, vt.u);
+			ParseFloatToken(p, LineEnd, vt.v);
+			OutFStaticMesh.TexCoords.push_back(vt);
+		}
+		else if (Type == "vn")
+		{
+			FVector v;
+
+			p = ParseFloatToken(p, LineEnd, v.x);
+			p = ParseFloatToken(p, LineEnd, v.y);
+			ParseFloatToken(p, LineEnd, v.z);
+			OutFStaticMesh.Normals.push_back(v);
+		}
+		else if (Type == "f")
+		{
+			Face.clear();
+			FaceRelativeMasks.clear();
+
+			uint8_t AnyRelative = 0;
+
+			const size_t Counts[3] = { OutFStaticMesh.Locations.size(), OutFStaticMesh.TexCoords.size(), OutFStaticMesh.Normals.size() };
+
+			while (true)
 			{
-				Vertex NewVertex;
+				p = SkipBlanks(p, LineEnd);
 
-				int vIdx = (int)FaceVertex.x;
+				if (p >= LineEnd)
 				{
-					if (vIdx >= 0 && vIdx < InFStaticMesh.Locations.size())
-					{
-						NewVertex.Location = InFStaticMesh.Locations[vIdx];
-					}
-					else
-					{
-						cout << "Vertex location index is out of range: " << vIdx << endl;
-						return;
-					}
+					break;
 				}
 
-				int vtIdx = (int)FaceVertex.y;
+				const char* TokenBegin = p;
+
+				while (p < LineEnd && !IsBlank(*p))
 				{
-					if (vtIdx >= 0 && vtIdx < InFStaticMesh.TexCoords.size())
-					{
-						NewVertex.TexCoord = InFStaticMesh.TexCoords[vtIdx];
-					}
-					else
-					{
-						cout << "Vertex UV index is out of range: " << vtIdx << endl;
-						return;
-					}
+					p++;
 				}
 
-				int vnIdx = (int)FaceVertex.z;
+				uint8_t RelativeMask = 0;
+
+				Face.push_back(ParseFaceVertex(string_view(TokenBegin, p - TokenBegin), Counts, RelativeMask));
+				FaceRelativeMasks.push_back(RelativeMask);
+				AnyRelative |= RelativeMask;
+			}
+
+			const size_t FirstCorner = OutFStaticMesh.Corners.size();
+
+			AddFace(Face.data(), Face.size(), OutFStaticMesh);
+
+			if (OutRelativeCorners && AnyRelative)
+			{
+				// Triangulate   ϰ  : [0, i, i + 1]
+				for (size_t c = FirstCorner; c < OutFStaticMesh.Corners.size(); c++)
 				{
-					if (vnIdx >= 0 && vnIdx < InFStaticMesh.Normals.size())
-					{
-						NewVertex.Normal = InFStaticMesh.Normals[vnIdx];
-					}
-					else
+					const size_t Triangle = (c - FirstCorner) / 3;
+					const size_t InTriangle = (c - FirstCorner) % 3;
+					const size_t Source = (InTriangle == 0) ? 0 : Triangle + InTriangle;
+
+					if (FaceRelativeMasks[Source])
 					{
-						cout << "Vertex normal index is out of range: " << vnIdx << endl;
-						return;
+						OutRelativeCorners->push_back({ static_cast<uint32_t>(c), FaceRelativeMasks[Source] });
 					}
 				}
+			}
+		}
+		else if (Type == "usemtl")
+		{
+			AddFaceRange(OutFStaticMesh.MaterialRanges, OutFStaticMesh.NumTriangles(), FName(RestOfLine(p, LineEnd)));
+		}
+		else if (Type == "o" || Type == "g")
+		{
+			AddFaceRange(OutFStaticMesh.GroupRanges, OutFStaticMesh.NumTriangles(), FName(RestOfLine(p, LineEnd)));
+		}
+		else if (Type == "mtllib")
+		{
+			while (true)
+			{
+				p = SkipBlanks(p, LineEnd);
+
+				if (p >= LineEnd)
+				{
+					break;
+				}
+
+				const char* TokenBegin = p;
 
-				int NewIndex = OutUStaticMesh.Vertices.size();
-				VertexMap[key] = NewIndex;
+				while (p < LineEnd && !IsBlank(*p))
+				{
+					p++;
+				}
 
-				OutUStaticMesh.Vertices.push_back(NewVertex);
-				OutUStaticMesh.Indices.push_back(NewIndex);
+				AddMaterialLibrary(OutFStaticMesh.MaterialLibraries, string(TokenBegin, p - TokenBegin));
 			}
 		}
+
+		LineBegin = LineEnd + 1;
 	}
 }
 
-void ShowUSMInfo(const UStaticMesh& InUStaticMesh)
+//   ũ ۷ 鼭    /ε ġ  Sink ѱ
+// ġ (ߺ  ̺ )  , v/vt/vn   ӽ Ϸ 
+bool StreamOBJ(const string& filename, const FOBJStreamOptions& Options, const FMeshBatchSink& Sink, FOBJStreamStats* OutStats)
 {
-	std::cout << "=== StaticMesh Translation (FStaticMesh -> UStaticMesh)  ===" << std::endl;
-	std::cout << "    : " << InUStaticMesh.Vertices.size() << "" << std::endl;
-	std::cout << " ε : " << InUStaticMesh.Indices.size() << "" << std::endl;
-}
\ No newline at end of file
+	ifstream file(filename, ios::binary);
+
+	if (!file.is_open())
+	{
+		cout << "Can't open file!" << endl;
+		return false;
+	}
+
+	//  й: б  1/16, ġ 1/4,  v/vt/vn  ĳ
+	// ġ  ϳ  88Ʈ (Vertex 32 + ߺ   2 32 + ε  6 24)
+	const size_t ReadBufferBytes = max<size_t>(64 << 10, Options.MemoryBudget / 16);
+	const size_t BatchBytes = Options.MemoryBudget / 4;
+	const size_t AttributeBytes = Options.MemoryBudget - min(Options.MemoryBudget, ReadBufferBytes + BatchBytes);
+	const size_t MaxBatchVertices = max<size_t>(3, BatchBytes / 88);
+	const size_t MaxBatchIndices = MaxBatchVertices * 6;
+
+	//  ̸  ÿ ͵(ٸ 峪 μ) ӽ  ġ ʵ  ̻縦 
+	static atomic<uint32_t> SpillSerial{ 0 };
+	const uint64_t SpillId = (static_cast<uint64_t>(random_device()()) << 32) | SpillSerial.fetch_add(1);
+	const string SpillBase = Options.SpillDirectory + "/" + filename.substr(filename.find_last_of("/\\") + 1) + ".spill." + to_string(SpillId) + ".";
+
+	TSpillArray<FVector> Locations(AttributeBytes / 2, SpillBase + "0");
+	TSpillArray<FVector2> TexCoords(AttributeBytes / 4, SpillBase + "1");
+	TSpillArray<FVector> Normals(AttributeBytes / 4, SpillBase + "2");
+
+	vector<Vertex> BatchVertices;
+	vector<int> BatchIndices;
+	FVertexDedupMap VertexMap(MaxBatchVertices);
+
+	BatchVertices.reserve(MaxBatchVertices);
+	BatchIndices.reserve(MaxBatchIndices);
+
+	vector<char> Buffer(ReadBufferBytes);
+	vector<FFaceCorner> Face;
+	vector<FFaceCorner> Triangles;
+
+	FOBJStreamStats Stats;
+
+	auto UpdatePeak = [&]()
+	{
+		const size_t Resident = Locations.GetResidentBytes() + TexCoords.GetResidentBytes() + Normals.GetResidentBytes()
+			+ BatchVertices.capacity() * sizeof(Vertex) + BatchIndices.capacity() * sizeof(int)
+			+ VertexMap.GetAllocatedSize() + Buffer.capacity();
+
+		Stats.PeakResidentBytes = max(Stats.PeakResidentBytes, Resident);
+	};
+
+	// ӽ    ̶  ٽ  v/vt/vn   Ƿ ߴ
+	auto SpillFailed = [&]()
+	{
+		if (Locations.HasFailed() || TexCoords.HasFailed() || Normals.HasFailed())
+		{
+			cout << "Can't access spill file: " << SpillBase << endl;
+			return true;
+		}
+
+		return false;
+	};
+
+	auto FlushBatch = [&]()
+	{
+		if (SpillFailed())
+		{
+			return false;
+		}
+
+		if (BatchIndices.empty())
+		{
+			return true;
+		}
+
+		UpdatePeak();
+
+		Sink({ BatchVertices.data(), BatchVertices.size(), BatchIndices.data(), BatchIndices.size(), Stats.NumBatches });
+
+		Stats.NumBatches++;
+		Stats.NumVertices += BatchVertices.size();
+		Stats.NumIndices += BatchIndices.size();
+
+		BatchVertices.clear();
+		BatchIndices.clear();
+		VertexMap.Clear();
+
+		return true;
+	};
+
+	auto AddCorner = [&](const FFaceCorner& Corner)
+	{
+		bool bAdded = false;
+		const int Index = VertexMap.FindOrAdd(Corner.Location, Corner.TexCoord, Corner.Normal, static_cast<int>(BatchVertices.size()), bAdded);
+
+		BatchIndices.push_back(Index);
+
+		if (!bAdded)
+		{
+			return true;
+		}
+
+		Vertex NewVertex;
+		NewVertex.TexCoord = { 0.0f, 0.0f };
+
+		if (Corner.Location >= 0 && static_cast<size_t>(Corner.Location) < Locations.Num())
+		{
+			NewVertex.Location = Locations[Corner.Location];
+		}
+		else
+		{
+			cout << "Vertex location index is out of range: " << Corner.Location << endl;
+			return false;
+		}
+
+		if (Corner.TexCoord >= 0 && static_cast<size_t>(Corner.TexCoord) < TexCoords.Num())
+		{
+			NewVertex.TexCoord = TexCoords[Corner.TexCoord];
+		}
+		else if (Corner.TexCoord != -1)
+		{
+			cout << "Vertex UV index is out of range: " << Corner.TexCoord << endl;
+			return false;
+		}
+
+		if (Corner.Normal >= 0 && static_cast<size_t>(Corner.Normal) < Normals.Num())
+		{
+			NewVertex.Normal = Normals[Corner.Normal];
+		}
+		else if (Corner.Normal != -1)
+		{
+			cout << "Vertex normal index is out of range: " << Corner.Normal << endl;
+			return false;
+		}
+
+		BatchVertices.push_back(NewVertex);
+
+		return true;
+	};
+
+	auto ProcessLine = [&](const char* p, const char* LineEnd)
+	{
+		p = SkipBlanks(p, LineEnd);
+		const char* TypeBegin = p;
+
+		while (p < LineEnd && !IsBlank(*p))
+		{
+			p++;
+		}
+
+		string_view Type(TypeBegin, p - TypeBegin);
+
+		if (Type == "v")
+		{
+			FVector v;
+
+			p = ParseFloatToken(p, LineEnd, v.x);
+			p = ParseFloatToken(p, LineEnd, v.y);
+			ParseFloatToken(p, LineEnd, v.z);
+			Locations.Add(v);
+		}
+		else if (Type == "vt")
+		{
+			FVector2 vt;
+
+			p = ParseFloatToken(p, LineEnd, vt.u);
+			ParseFloatToken(p, LineEnd, vt.v);
+			TexCoords.Add(vt);
+		}
+		else if (Type == "vn")
+		{
+			FVector v;
+
+			p = ParseFloatToken(p, LineEnd, v.x);
+			p = ParseFloatToken(p, LineEnd, v.y);
+			ParseFloatToken(p, LineEnd, v.z);
+			Normals.Add(v);
+		}
+		else if (Type == "f")
+		{
+			const size_t Counts[3] = { Locations.Num(), TexCoords.Num(), Normals.Num() };
+
+			Face.clear();
+			Triangles.clear();
+
+			while (true)
+			{
+				p = SkipBlanks(p, LineEnd);
+
+				if (p >= LineEnd)
+				{
+					break;
+				}
+
+				const char* TokenBegin = p;
+
+				while (p < LineEnd && !IsBlank(*p))
+				{
+					p++;
+				}
+
+				uint8_t RelativeMask = 0;
+
+				Face.push_back(ParseFaceVertex(string_view(TokenBegin, p - TokenBegin), Counts, RelativeMask));
+			}
+
+			Triangulate(Face.data(), Face.size(), Triangles);
+
+			// ﰢ ġ 迡 ߸ ʵ ﰢ  ˻
+			for (size_t i = 0; i < Triangles.size(); i += 3)
+			{
+				if ((BatchVertices.size() + 3 > MaxBatchVertices || BatchIndices.size() + 3 > MaxBatchIndices) && !FlushBatch())
+				{
+					return false;
+				}
+
+				if (!AddCorner(Triangles[i]) || !AddCorner(Triangles[i + 1]) || !AddCorner(Triangles[i + 2]))
+				{
+					return false;
+				}
+			}
+		}
+
+		return true;
+	};
+
+	size_t Filled = 0;
+
+	while (true)
+	{
+		file.read(Buffer.data() + Filled, Buffer.size() - Filled);
+		Filled += static_cast<size_t>(file.gcount());
+
+		const bool bEndOfFile = !file;
+		const char* Begin = Buffer.data();
+		const char* End = Begin + Filled;
+
+		//   ߸   б ѱ
+		const char* LastNewLine = End;
+
+		while (LastNewLine > Begin && LastNewLine[-1] != '\n')
+		{
+			LastNewLine--;
+		}
+
+		if (bEndOfFile)
+		{
+			LastNewLine = End;
+		}
+		else if (LastNewLine == Begin)
+		{
+			//   ۺ  ۸ ÷ ٽ 
+			Buffer.resize(Buffer.size() * 2);
+			continue;
+		}
+
+		const char* LineBegin = Begin;
+
+		while (LineBegin < LastNewLine)
+		{
+			const char* LineEnd = static_cast<const char*>(memchr(LineBegin, '\n', LastNewLine - LineBegin));
+
+			if (LineEnd == nullptr)
+			{
+				LineEnd = LastNewLine;
+			}
+
+			if (!ProcessLine(LineBegin, LineEnd))
+			{
+				return false;
+			}
+
+			LineBegin = LineEnd + 1;
+		}
+
+		if (bEndOfFile)
+		{
+			break;
+		}
+
+		Filled = End - LastNewLine;
+		memmove(Buffer.data(), LastNewLine, Filled);
+	}
+
+	if (!FlushBatch())
+	{
+		return false;
+	}
+
+	Stats.SpilledBytes = Locations.GetSpilledBytes() + TexCoords.GetSpilledBytes() + Normals.GetSpilledBytes();
+
+	if (OutStats)
+	{
+		*OutStats = Stats;
+	}
+
+	return true;
+}
+
+//  ε ݱ     ε (-1 =  )
+FFaceCorner ParseFaceVertex(const string& VertexData, const FStaticMesh& InFStaticMesh)
+{
+	const size_t Counts[3] = { InFStaticMesh.Locations.size(), InFStaticMesh.TexCoords.size(), InFStaticMesh.Normals.size() };
+
+	FFaceCorner fv = { -1, -1, -1 };
+
+	std::stringstream ss(VertexData);
+	std::string token;
+	int index = 0;
+
+	// "/"  и: "1/2/3" -> "1", "2", "3"
+	while (std::getline(ss, token, '/'))
+	{
+		if (!token.empty()) 
+		{
+			// 0 ϵ ȯ
+			int value = std::stoi(token);
+
+			if (index < 3)
+			{
+				value = (value < 0) ? static_cast<int>(Counts[index]) + value + 1 : value;
+			}
+
+			if (index == 0)
+			{ 
+				fv.Location = value - 1;
+			}
+			else if (index == 1)
+			{
+				fv.TexCoord = value - 1;
+			}
+			else if (index == 2)
+			{ 
+				fv.Normal = value - 1;
+			}
+		}
+		index++;
+	}
+
+	return fv;
+}
+
+FFaceCorner ParseFaceVertex(string_view VertexData, const size_t (&Counts)[3], uint8_t& OutRelativeMask)
+{
+	FFaceCorner fv = { -1, -1, -1 };
+	int32_t* Components[3] = { &fv.Location, &fv.TexCoord, &fv.Normal };
+	size_t index = 0;
+
+	while (index < 3)
+	{
+		size_t Slash = VertexData.find('/');
+		string_view Token = VertexData.substr(0, Slash);
+
+		if (!Token.empty())
+		{
+			int value = 0;
+			const char* TokenBegin = Token.data();
+
+			if (*TokenBegin == '+')
+			{
+				TokenBegin++;
+			}
+
+			if (from_chars(TokenBegin, Token.data() + Token.size(), value).ec == errc())
+			{
+				if (value < 0)
+				{
+					*Components[index] = static_cast<int32_t>(Counts[index]) + value;
+					OutRelativeMask |= static_cast<uint8_t>(1 << index);
+				}
+				else
+				{
+					*Components[index] = value - 1;
+				}
+			}
+		}
+
+		if (Slash == string_view::npos)
+		{
+			break;
+		}
+
+		VertexData.remove_prefix(Slash + 1);
+		index++;
+	}
+
+	return fv;
+}
+
+//  ϳ ﰢ  Corners ڿ ̰  ġ FaceOffsets 
+void AddFace(const FFaceCorner* InFace, size_t NumCorners, FStaticMesh& OutFStaticMesh)
+{
+	const size_t FirstCorner = OutFStaticMesh.Corners.size();
+
+	Triangulate(InFace, NumCorners, OutFStaticMesh.Corners);
+
+	if (OutFStaticMesh.Corners.size() != FirstCorner)
+	{
+		OutFStaticMesh.FaceOffsets.push_back(static_cast<uint32_t>(FirstCorner));
+	}
+}
+
+//  ﰢ ġ ̸ ޾ ٲ  ͸ , ̸ ״θ    
+void AddFaceRange(vector<FFaceRange>& OutRanges, size_t FirstTriangle, FName Name)
+{
+	if (!OutRanges.empty() && OutRanges.back().FirstTriangle == FirstTriangle)
+	{
+		OutRanges.back().Name = Name;
+		return;
+	}
+
+	const FName CurrentName = OutRanges.empty() ? FName() : OutRanges.back().Name;
+
+	if (CurrentName == Name)
+	{
+		return;
+	}
+
+	OutRanges.push_back({ static_cast<uint32_t>(FirstTriangle), Name });
+}
+
+void AddMaterialLibrary(vector<string>& OutLibraries, const string& filename)
+{
+	if (find(OutLibraries.begin(), OutLibraries.end(), filename) == OutLibraries.end())
+	{
+		OutLibraries.push_back(filename);
+	}
+}
+
+void Triangulate(const FFaceCorner* InFace, size_t NumCorners, vector<FFaceCorner>& OutCorners)
+{
+	// ּ 3  ʿ
+	if (NumCorners < 3)
+	{
+		return;
+	}
+
+	// ̹ ﰢ̸ ״ ߰
+	if (NumCorners == 3)
+	{
+		OutCorners.insert(OutCorners.end(), InFace, InFace + 3);
+		return;
+	}
+
+	// Fan Triangulation: ù °  ߽ ﰢ 
+	// : [v0, v1, v2, v3] -> [v0,v1,v2], [v0,v2,v3]
+	for (size_t i = 1; i < NumCorners - 1; i++) {
+		OutCorners.push_back(InFace[0]);      // ù °  (߽)
+		OutCorners.push_back(InFace[i]);      //  
+		OutCorners.push_back(InFace[i + 1]);  //  
+	}
+}
+
+//  ﰢ     ϳ  ( ó  ,  ȿ   )
+//  ϳ̸ OutTriangleOrder   (  ״)
+void SortTrianglesByMaterial(const FStaticMesh& InFStaticMesh, vector<uint32_t>& OutTriangleOrder, vector<FStaticMeshSection>& OutSections)
+{
+	const size_t NumTriangles = InFStaticMesh.NumTriangles();
+	const vector<FFaceRange>& Ranges = InFStaticMesh.MaterialRanges;
+
+	OutTriangleOrder.clear();
+	OutSections.clear();
+
+	// [Begin, End) ﰢ    ȣ (FName IDθ ã)
+	struct FSpan
+	{
+		size_t Begin;
+		size_t End;
+		uint32_t Slot;
+	};
+
+	vector<FSpan> Spans;
+	vector<size_t> SlotTriangles;
+	unordered_map<FName, uint32_t> SlotOfMaterial;
+
+	auto AddSpan = [&](size_t Begin, size_t End, FName Material)
+	{
+		if (Begin >= End)
+		{
+			return;
+		}
+
+		auto It = SlotOfMaterial.find(Material);
+
+		if (It == SlotOfMaterial.end())
+		{
+			It = SlotOfMaterial.emplace(Material, static_cast<uint32_t>(OutSections.size())).first;
+			OutSections.push_back({ Material, 0, 0 });
+			SlotTriangles.push_back(0);
+		}
+
+		Spans.push_back({ Begin, End, It->second });
+		SlotTriangles[It->second] += End - Begin;
+	};
+
+	AddSpan(0, Ranges.empty() ? NumTriangles : min<size_t>(Ranges[0].FirstTriangle, NumTriangles), FName());
+
+	for (size_t r = 0; r < Ranges.size(); r++)
+	{
+		const size_t End = (r + 1 < Ranges.size()) ? Ranges[r + 1].FirstTriangle : NumTriangles;
+		AddSpan(Ranges[r].FirstTriangle, min(End, NumTriangles), Ranges[r].Name);
+	}
+
+	size_t FirstTriangle = 0;
+
+	for (size_t Slot = 0; Slot < OutSections.size(); Slot++)
+	{
+		OutSections[Slot].FirstIndex = static_cast<uint32_t>(FirstTriangle * 3);
+		OutSections[Slot].NumIndices = static_cast<uint32_t>(SlotTriangles[Slot] * 3);
+		FirstTriangle += SlotTriangles[Slot];
+	}
+
+	if (OutSections.size() <= 1)
+	{
+		return;
+	}
+
+	OutTriangleOrder.resize(NumTriangles);
+
+	vector<size_t> Cursor(OutSections.size());
+
+	for (size_t Slot = 0; Slot < OutSections.size(); Slot++)
+	{
+		Cursor[Slot] = OutSections[Slot].FirstIndex / 3;
+	}
+
+	for (const FSpan& Span : Spans)
+	{
+		for (size_t t = Span.Begin; t < Span.End; t++)
+		{
+			OutTriangleOrder[Cursor[Span.Slot]++] = static_cast<uint32_t>(t);
+		}
+	}
+}
+
+// (ġ, UV, ) ε    ϳ  ħ (ó   ȣ ο)
+// UV ε (-1)  0 ä,  ε     GenerateNormals ä
+// ﰢ  (Sections)  ٽ ġ
+//   ε  /ε/  false (  ޽ø  )
+bool BuildStaticMesh(const FStaticMesh& InFStaticMesh, UStaticMesh& OutUStaticMesh)
+{
+	const size_t CornerCount = InFStaticMesh.Corners.size();
+
+	FVertexDedupMap VertexMap(CornerCount);
+
+	vector<uint32_t> TriangleOrder;
+	SortTrianglesByMaterial(InFStaticMesh, TriangleOrder, OutUStaticMesh.Sections);
+
+	OutUStaticMesh.MaterialLibraries = InFStaticMesh.MaterialLibraries;
+	OutUStaticMesh.Tangents.clear();
+	OutUStaticMesh.Vertices.clear();
+	OutUStaticMesh.Indices.clear();
+	OutUStaticMesh.Indices.reserve(CornerCount);
+
+	const int NumLocations = static_cast<int>(InFStaticMesh.Locations.size());
+	const int NumTexCoords = static_cast<int>(InFStaticMesh.TexCoords.size());
+	const int NumNormals = static_cast<int>(InFStaticMesh.Normals.size());
+
+	const FFaceCorner* Corners = InFStaticMesh.Corners.data();
+
+	bool bMissingNormals = false;
+
+	auto FailBuild = [&OutUStaticMesh]()
+	{
+		OutUStaticMesh.Vertices.clear();
+		OutUStaticMesh.Indices.clear();
+		OutUStaticMesh.Sections.clear();
+		OutUStaticMesh.Tangents.clear();
+		OutUStaticMesh.Bounds = FBox();
+		OutUStaticMesh.BoundingSphere = FSphere();
+		return false;
+	};
+
+	for (size_t i = 0; i < CornerCount; i++)
+	{
+		const size_t Triangle = TriangleOrder.empty() ? i / 3 : TriangleOrder[i / 3];
+		const FFaceCorner& FaceVertex = Corners[Triangle * 3 + i % 3];
+		const int vIdx = FaceVertex.Location;
+		const int vtIdx = FaceVertex.TexCoord;
+		const int vnIdx = FaceVertex.Normal;
+
+		// ε ۿ ֱ   ε  ˻
+		if (vIdx < 0 || vIdx >= NumLocations)
+		{
+			cout << "Vertex location index is out of range: " << vIdx << endl;
+			return FailBuild();
+		}
+
+		if (vtIdx < -1 || vtIdx >= NumTexCoords)
+		{
+			cout << "Vertex UV index is out of range: " << vtIdx << endl;
+			return FailBuild();
+		}
+
+		if (vnIdx < -1 || vnIdx >= NumNormals)
+		{
+			cout << "Vertex normal index is out of range: " << vnIdx << endl;
+			return FailBuild();
+		}
+
+		bool bAdded = false;
+		const int NewIndex = static_cast<int>(OutUStaticMesh.Vertices.size());
+		const int Index = VertexMap.FindOrAdd(vIdx, vtIdx, vnIdx, NewIndex, bAdded);
+
+		OutUStaticMesh.Indices.push_back(Index);
+
+		if (!bAdded)
+		{
+			continue;
+		}
+
+		Vertex NewVertex;
+		NewVertex.Location = InFStaticMesh.Locations[vIdx];
+		NewVertex.TexCoord = (vtIdx != -1) ? InFStaticMesh.TexCoords[vtIdx] : FVector2{ 0.0f, 0.0f };
+
+		if (vnIdx != -1)
+		{
+			NewVertex.Normal = InFStaticMesh.Normals[vnIdx];
+		}
+		else
+		{
+			bMissingNormals = true;
+		}
+
+		OutUStaticMesh.Vertices.push_back(NewVertex);
+	}
+
+	if (bMissingNormals)
+	{
+		FNormalOptions Options;
+		Options.bOnlyMissing = true;
+
+		GenerateNormals(OutUStaticMesh, Options);
+	}
+
+	ComputeMeshBounds(OutUStaticMesh);
+
+	return true;
+}
+
+// ڿ Ű + std::map  (ó 񱳿)
+void BuildStaticMeshLegacy(const FStaticMesh& InFStaticMesh, UStaticMesh& OutUStaticMesh)
+{
+	map<string, int> VertexMap;
+
+	OutUStaticMesh.Vertices.clear();
+	OutUStaticMesh.Indices.clear();
+		
+	for (const auto& FaceVertex : InFStaticMesh.Corners)
+	{
+		string key = to_string(FaceVertex.Location) + "/" + to_string(FaceVertex.TexCoord) + "/" + to_string(FaceVertex.Normal);
+
+		auto it = VertexMap.find(key);
+
+		if (it != VertexMap.end())
+		{
+			OutUStaticMesh.Indices.push_back(it->second);
+		}
+		else
+		{
+			Vertex NewVertex;
+
+			int vIdx = FaceVertex.Location;
+			{
+				if (vIdx >= 0 && vIdx < InFStaticMesh.Locations.size())
+				{
+					NewVertex.Location = InFStaticMesh.Locations[vIdx];
+				}
+				else
+				{
+					cout << "Vertex location index is out of range: " << vIdx << endl;
+					return;
+				}
+			}
+
+			int vtIdx = FaceVertex.TexCoord;
+			{
+				if (vtIdx >= 0 && vtIdx < InFStaticMesh.TexCoords.size())
+				{
+					NewVertex.TexCoord = InFStaticMesh.TexCoords[vtIdx];
+				}
+				else
+				{
+					cout << "Vertex UV index is out of range: " << vtIdx << endl;
+					return;
+				}
+			}
+
+			int vnIdx = FaceVertex.Normal;
+			{
+				if (vnIdx >= 0 && vnIdx < InFStaticMesh.Normals.size())
+				{
+					NewVertex.Normal = InFStaticMesh.Normals[vnIdx];
+				}
+				else
+				{
+					cout << "Vertex normal index is out of range: " << vnIdx << endl;
+					return;
+				}
+			}
+
+			int NewIndex = OutUStaticMesh.Vertices.size();
+			VertexMap[key] = NewIndex;
+
+			OutUStaticMesh.Vertices.push_back(NewVertex);
+			OutUStaticMesh.Indices.push_back(NewIndex);
+		}
+	}
+}
+
+void ShowUSMInfo(const UStaticMesh& InUStaticMesh)
+{
+	std::cout << "=== StaticMesh Translation (FStaticMesh -> UStaticMesh)  ===" << std::endl;
+	std::cout << "    : " << InUStaticMesh.Vertices.size() << "" << std::endl;
+	std::cout << " ε : " << InUStaticMesh.Indices.size() << "" << std::endl;
+	std::cout << "  : " << InUStaticMesh.Sections.size() << "" << std::endl;
+
+	const FBox& Bounds = InUStaticMesh.Bounds;
+
+	std::cout << "ٿ ڽ : (" << Bounds.Min.x << ", " << Bounds.Min.y << ", " << Bounds.Min.z << ") ~ (" << Bounds.Max.x << ", " << Bounds.Max.y << ", " << Bounds.Max.z << ")" << std::endl;
+	std::cout << "ٿ    :  " << InUStaticMesh.BoundingSphere.Radius << std::endl;
+}
+
+//  OBJ ؽð  ŷ (filename + ".cooked")  ؼ ε, ų  Ľ  ٽ ŷ
+// bOptimize  ڿ  ĳ/fetch ȭ ģ   ŷ (".opt.cooked") 
+bool LoadStaticMesh(const string& filename, UStaticMesh& OutUStaticMesh, bool bOptimize)
+{
+	uint64_t SourceHash = 0;
+	uint64_t SourceSize = 0;
+
+	if (!HashSourceFile(filename, SourceHash, SourceSize))
+	{
+		cout << "Can't open file!" << endl;
+		return false;
+	}
+
+	const string CookedPath = filename + (bOptimize ? ".opt.cooked" : ".cooked");
+
+	FCookedMesh Cooked;
+
+	if (Cooked.Open(CookedPath, SourceHash, SourceSize))
+	{
+		Cooked.CopyTo(OutUStaticMesh);
+		return true;
+	}
+
+	FStaticMesh FSM;
+
+	ParseOBJParallel(filename, FSM);
+
+	if (!BuildStaticMesh(FSM, OutUStaticMesh))
+	{
+		return false;
+	}
+
+	if (bOptimize)
+	{
+		OptimizeStaticMesh(OutUStaticMesh);
+	}
+
+	if (!SaveCookedMesh(CookedPath, OutUStaticMesh, SourceHash, SourceSize))
+	{
+		cout << "Can't write cooked file: " << CookedPath << endl;
+	}
+
+	return true;
+}
+
+bool LoadMaterials(const string& filename, vector<MtlMaterial>& OutMaterials)
+{
+	uint64_t SourceHash = 0;
+	uint64_t SourceSize = 0;
+
+	if (!HashSourceFile(filename, SourceHash, SourceSize))
+	{
+		cout << "Can't open file!" << endl;
+		return false;
+	}
+
+	const string CookedPath = filename + ".cooked";
+
+	if (LoadCookedMaterials(CookedPath, SourceHash, SourceSize, OutMaterials))
+	{
+		return true;
+	}
+
+	FMappedFile File;
+
+	if (!File.Open(filename))
+	{
+		cout << "Can't open file!" << endl;
+		return false;
+	}
+
+	OutMaterials.clear();
+	parseMtl(File.View(), OutMaterials);
+
+	if (!SaveCookedMaterials(CookedPath, OutMaterials, SourceHash, SourceSize))
+	{
+		cout << "Can't write cooked file: " << CookedPath << endl;
+	}
+
+	return true;
+}
+
+// mtllib (OBJ    ) о ̺귯 ߰
+//   (None )  ã true
+bool ResolveMaterials(const string& filename, const UStaticMesh& InUStaticMesh, FMaterialLibrary& OutLibrary)
+{
+	const filesystem::path Directory = filesystem::path(filename).parent_path();
+
+	for (const string& Library : InUStaticMesh.MaterialLibraries)
+	{
+		vector<MtlMaterial> Materials;
+
+		if (LoadMaterials((Directory / Library).generic_string(), Materials))
+		{
+			OutLibrary.Add(Materials);
+		}
+	}
+
+	bool bResolved = true;
+
+	for (const FStaticMeshSection& Section : InUStaticMesh.Sections)
+	{
+		if (!Section.Material.IsNone() && OutLibrary.Find(Section.Material) == nullptr)
+		{
+			cout << "Material not found: " << Section.Material.ToString() << endl;
+			bResolved = false;
+		}
+	}
+
+	return bResolved;
+}
+
+// ׷   (ο)  ϰ,  ε ۸ ƴ  Ȯ
+void ShowSectionInfo(const string& filename)
+{
+	FStaticMesh FSM;
+	UStaticMesh USM;
+	FMaterialLibrary Library;
+
+	ParseOBJParallel(filename, FSM);
+	BuildStaticMesh(FSM, USM);
+
+	const bool bResolved = ResolveMaterials(filename, USM, Library);
+
+	//   ﰢ    ũ 
+	unordered_map<FName, size_t> SourceTriangles;
+
+	for (size_t r = 0; r < FSM.MaterialRanges.size(); r++)
+	{
+		const size_t End = (r + 1 < FSM.MaterialRanges.size()) ? FSM.MaterialRanges[r + 1].FirstTriangle : FSM.NumTriangles();
+		SourceTriangles[FSM.MaterialRanges[r].Name] += End - FSM.MaterialRanges[r].FirstTriangle;
+	}
+
+	if (FSM.MaterialRanges.empty() || FSM.MaterialRanges[0].FirstTriangle > 0)
+	{
+		SourceTriangles[FName()] += FSM.MaterialRanges.empty() ? FSM.NumTriangles() : FSM.MaterialRanges[0].FirstTriangle;
+	}
+
+	bool bContiguous = true;
+	uint32_t NextIndex = 0;
+
+	std::cout << "===   (" << filename << ") ===" << std::endl;
+	std::cout << "׷        : " << FSM.GroupRanges.size() << "" << std::endl;
+	std::cout << "ο      : " << USM.Sections.size() << " ( 1)" << std::endl;
+
+	for (const FStaticMeshSection& Section : USM.Sections)
+	{
+		const MtlMaterial* Material = Library.Find(Section.Material);
+
+		bContiguous = bContiguous && Section.FirstIndex == NextIndex && SourceTriangles[Section.Material] * 3 == Section.NumIndices;
+		NextIndex = Section.FirstIndex + Section.NumIndices;
+
+		std::cout << "  " << (Section.Material.IsNone() ? "(None)" : Section.Material.ToString())
+			<< " : ε [" << Section.FirstIndex << ", " << NextIndex << ")"
+			<< ", Kd " << (Material ? to_string(Material->Kd.x) + " " + to_string(Material->Kd.y) + " " + to_string(Material->Kd.z) : string("-"))
+			<< (Material && !Material->map_Kd.empty() ? ", map_Kd " + Material->map_Kd : string()) << std::endl;
+	}
+
+	bContiguous = bContiguous && NextIndex == USM.Indices.size();
+
+	std::cout << "      : " << (bContiguous ? "O" : "X") << std::endl;
+	std::cout << "      : " << (bResolved ? "O" : "X") << std::endl;
+}
+
+// Data  ޽/ ü ε ð 
+void LoadAssetSet()
+{
+	const char* MeshFiles[] = { "Data/cube-tex.obj", "Data/bitten_apple_mid.obj", "Data/apple_mid.obj" };
+	const char* MaterialFiles[] = { "Data/cube-tex.mtl", "Data/bitten_apple_mid.mtl", "Data/apple_mid.mtl" };
+
+	using Clock = chrono::steady_clock;
+
+	auto Start = Clock::now();
+
+	size_t NumVertices = 0;
+	size_t NumMaterials = 0;
+
+	for (const char* MeshFile : MeshFiles)
+	{
+		UStaticMesh USM;
+
+		LoadStaticMesh(MeshFile, USM);
+		NumVertices += USM.Vertices.size();
+	}
+
+	for (const char* MaterialFile : MaterialFiles)
+	{
+		vector<MtlMaterial> Materials;
+
+		LoadMaterials(MaterialFile, Materials);
+		NumMaterials += Materials.size();
+	}
+
+	chrono::duration<double> Seconds = Clock::now() - Start;
+
+	std::cout << "===  ε (޽ " << size(MeshFiles) << ",   " << size(MaterialFiles) << ") ===" << std::endl;
+	std::cout << "    : " << NumVertices << "" << std::endl;
+	std::cout << "    : " << NumMaterials << "" << std::endl;
+	std::cout << "ҿ ð   : " << Seconds.count() * 1000.0 << " ms" << std::endl;
+}
+
+// δ  OBJ ܰ Լ (Ľ ûũ  ٽ   Ǯ )
+FMeshLoadStages MakeOBJLoadStages(bool bOptimize, FThreadPool& Pool)
+{
+	FMeshLoadStages Stages;
+
+	Stages.Parse = [&Pool](const string& filename, FStaticMesh& OutFStaticMesh)
+	{
+		ParseOBJParallel(filename, OutFStaticMesh, Pool);
+	};
+
+	Stages.Build = [](const FStaticMesh& InFStaticMesh, UStaticMesh& OutUStaticMesh)
+	{
+		if (!BuildStaticMesh(InFStaticMesh, OutUStaticMesh))
+		{
+			throw runtime_error("Invalid face index in mesh");
+		}
+	};
+
+	if (bOptimize)
+	{
+		Stages.Optimize = [](UStaticMesh& InOutUStaticMesh)
+		{
+			OptimizeStaticMesh(InOutUStaticMesh);
+		};
+	}
+
+	return Stages;
+}
+
+//   OBJ ü   ϳ ε  δ Ѳ û  ð ð 
+void ShowLoaderInfo(const string& Directory)
+{
+	vector<string> MeshFiles;
+
+	for (const filesystem::directory_entry& Entry : filesystem::directory_iterator(Directory))
+	{
+		if (Entry.is_regular_file() && Entry.path().extension() == ".obj")
+		{
+			MeshFiles.push_back(Entry.path().generic_string());
+		}
+	}
+
+	sort(MeshFiles.begin(), MeshFiles.end());
+
+	using Clock = chrono::steady_clock;
+
+	const FMeshLoadStages Stages = MakeOBJLoadStages(true);
+	vector<UStaticMesh> SequentialMeshes(MeshFiles.size());
+
+	auto SequentialStart = Clock::now();
+
+	for (size_t i = 0; i < MeshFiles.size(); i++)
+	{
+		FStaticMesh FSM;
+
+		Stages.Parse(MeshFiles[i], FSM);
+		Stages.Build(FSM, SequentialMeshes[i]);
+		Stages.Optimize(SequentialMeshes[i]);
+	}
+
+	chrono::duration<double> SequentialSeconds = Clock::now() - SequentialStart;
+
+	vector<FMeshLoadHandle> Handles;
+	bool bSameResults = true;
+
+	auto PipelinedStart = Clock::now();
+
+	{
+		FMeshLoader Loader(Stages);
+
+		for (const string& MeshFile : MeshFiles)
+		{
+			Handles.push_back(Loader.Request(MeshFile));
+		}
+
+		Loader.WaitAll();
+	}
+
+	chrono::duration<double> PipelinedSeconds = Clock::now() - PipelinedStart;
+
+	std::cout << "=== 񵿱  ε (" << Directory << ", ޽ " << MeshFiles.size() << ", Ŀ " << FThreadPool::Get().Num() << ") ===" << std::endl;
+
+	for (size_t i = 0; i < Handles.size(); i++)
+	{
+		const FMeshLoadHandle& Handle = Handles[i];
+		const FAssetLoadTiming& Timing = Handle.GetTiming();
+		bSameResults = bSameResults && IsSameUStaticMesh(Handle.Wait(), SequentialMeshes[i]);
+
+		std::cout << Handle.GetFilename() << std::endl;
+		std::cout << "   " << Timing.QueueSeconds * 1000.0 << " ms, Ľ " << Timing.ParseSeconds * 1000.0
+			<< " ms,  " << Timing.BuildSeconds * 1000.0 << " ms, ȭ " << Timing.OptimizeSeconds * 1000.0
+			<< " ms, ü " << Timing.TotalSeconds * 1000.0 << " ms" << std::endl;
+	}
+
+	std::cout << " ε     : " << SequentialSeconds.count() * 1000.0 << " ms" << std::endl;
+	std::cout << "    : " << PipelinedSeconds.count() * 1000.0 << " ms (" << SequentialSeconds.count() / PipelinedSeconds.count() << ")" << std::endl;
+	std::cout << " ġ     : " << (bSameResults ? "O" : "X") << std::endl;
+
+	// ܰ迡 ܰ  Wait/WaitAll , ܴ ڵ Wait ٽ ; 
+	FMeshLoadStages ThrowingStages = Stages;
+	ThrowingStages.Parse = [](const string&, FStaticMesh&) { throw runtime_error("Parse failed"); };
+
+	bool bFailureReported = false;
+
+	{
+		FMeshLoader Loader(ThrowingStages);
+		FMeshLoadHandle Failed = Loader.Request(MeshFiles.empty() ? string() : MeshFiles[0]);
+
+		Loader.WaitAll();
+
+		try
+		{
+			Failed.Wait();
+		}
+		catch (const runtime_error&)
+		{
+			bFailureReported = Failed.IsReady();
+		}
+	}
+
+	std::cout << "ܰ   : " << (bFailureReported ? "O" : "X") << std::endl;
+}
+
+bool IsSameFStaticMesh(const FStaticMesh& A, const FStaticMesh& B)
+{
+	auto SameBytes = [](const auto& L, const auto& R)
+	{
+		return L.size() == R.size() && (L.empty() || memcmp(L.data(), R.data(), L.size() * sizeof(L[0])) == 0);
+	};
+
+	if (!SameBytes(A.Locations, B.Locations) || !SameBytes(A.TexCoords, B.TexCoords) || !SameBytes(A.Normals, B.Normals))
+	{
+		return false;
+	}
+
+	return SameBytes(A.Corners, B.Corners) && SameBytes(A.FaceOffsets, B.FaceOffsets)
+		&& SameBytes(A.MaterialRanges, B.MaterialRanges) && SameBytes(A.GroupRanges, B.GroupRanges)
+		&& A.MaterialLibraries == B.MaterialLibraries;
+}
+
+// /ε/źƮ      (ٿ  ǹǷ )
+bool IsSameUStaticMesh(const UStaticMesh& A, const UStaticMesh& B)
+{
+	auto SameBytes = [](const auto& L, const auto& R)
+	{
+		return L.size() == R.size() && (L.empty() || memcmp(L.data(), R.data(), L.size() * sizeof(L[0])) == 0);
+	};
+
+	if (!SameBytes(A.Vertices, B.Vertices) || !SameBytes(A.Indices, B.Indices) || !SameBytes(A.Tangents, B.Tangents))
+	{
+		return false;
+	}
+
+	if (A.Sections.size() != B.Sections.size() || A.MaterialLibraries != B.MaterialLibraries)
+	{
+		return false;
+	}
+
+	for (size_t i = 0; i < A.Sections.size(); i++)
+	{
+		const FStaticMeshSection& L = A.Sections[i];
+		const FStaticMeshSection& R = B.Sections[i];
+
+		if (!(L.Material == R.Material) || L.FirstIndex != R.FirstIndex || L.NumIndices != R.NumIndices)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+//  getline/stringstream ο   ó(MB/s) 
+void CompareParseThroughput(const string& filename)
+{
+	FMappedFile File;
+
+	if (!File.Open(filename))
+	{
+		cout << "Can't open file!" << endl;
+		return;
+	}
+
+	const double FileMB = File.Size / (1024.0 * 1024.0);
+	File.Close();
+
+	using Clock = chrono::steady_clock;
+
+	FStaticMesh LegacyFSM, MappedFSM, ParallelFSM;
+
+	auto LegacyStart = Clock::now();
+	ParseOBJ(filename, LegacyFSM);
+	chrono::duration<double> LegacySeconds = Clock::now() - LegacyStart;
+
+	auto MappedStart = Clock::now();
+	ParseOBJMapped(filename, MappedFSM);
+	chrono::duration<double> MappedSeconds = Clock::now() - MappedStart;
+
+	auto ParallelStart = Clock::now();
+	ParseOBJParallel(filename, ParallelFSM);
+	chrono::duration<double> ParallelSeconds = Clock::now() - ParallelStart;
+
+	std::cout << "=== OBJ Parsing ó  (" << filename << ", " << FileMB << " MB) ===" << std::endl;
+	std::cout << "getline/stringstream : " << LegacySeconds.count() * 1000.0 << " ms, " << FileMB / LegacySeconds.count() << " MB/s" << std::endl;
+	std::cout << "mmap/from_chars      : " << MappedSeconds.count() * 1000.0 << " ms, " << FileMB / MappedSeconds.count() << " MB/s" << std::endl;
+	std::cout << "mmap/(" << FThreadPool::Get().Num() << " )    : " << ParallelSeconds.count() * 1000.0 << " ms, " << FileMB / ParallelSeconds.count() << " MB/s" << std::endl;
+	std::cout << " ġ            : " << (IsSameFStaticMesh(LegacyFSM, MappedFSM) && IsSameFStaticMesh(MappedFSM, ParallelFSM) ? "O" : "X") << std::endl;
+}
+
+// ڿ Ű map İ  Ű  巹  BuildStaticMesh ó 
+void CompareBuildThroughput(const FStaticMesh& InFStaticMesh)
+{
+	using Clock = chrono::steady_clock;
+
+	UStaticMesh LegacyUSM, DedupUSM;
+
+	auto LegacyStart = Clock::now();
+	BuildStaticMeshLegacy(InFStaticMesh, LegacyUSM);
+	chrono::duration<double> LegacySeconds = Clock::now() - LegacyStart;
+
+	auto DedupStart = Clock::now();
+	BuildStaticMesh(InFStaticMesh, DedupUSM);
+	chrono::duration<double> DedupSeconds = Clock::now() - DedupStart;
+
+	const bool bSame = LegacyUSM.Indices == DedupUSM.Indices
+		&& LegacyUSM.Vertices.size() == DedupUSM.Vertices.size()
+		&& (DedupUSM.Vertices.empty() || memcmp(LegacyUSM.Vertices.data(), DedupUSM.Vertices.data(), DedupUSM.Vertices.size() * sizeof(Vertex)) == 0);
+
+	std::cout << "=== BuildStaticMesh ó  (ﰢ " << InFStaticMesh.NumTriangles() << ") ===" << std::endl;
+	std::cout << "map<string, int>     : " << LegacySeconds.count() * 1000.0 << " ms" << std::endl;
+	std::cout << "FVertexDedupMap      : " << DedupSeconds.count() * 1000.0 << " ms (" << LegacySeconds.count() / DedupSeconds.count() << ")" << std::endl;
+	std::cout << " ġ            : " << (bSame ? "O" : "X") << std::endl;
+
+	//   ġ   ﰢ (f 1 2 9,  3)
+	FStaticMesh BadFSM;
+	BadFSM.Locations = { FVector(0, 0, 0), FVector(1, 0, 0), FVector(0, 1, 0) };
+	BadFSM.Corners = { { 0, -1, -1 }, { 1, -1, -1 }, { 8, -1, -1 } };
+	BadFSM.FaceOffsets = { 0 };
+
+	UStaticMesh BadUSM = DedupUSM;
+	const bool bRejected = !BuildStaticMesh(BadFSM, BadUSM) && BadUSM.Vertices.empty() && BadUSM.Indices.empty() && BadUSM.Sections.empty();
+
+	std::cout << "߸ ε ź   : " << (bRejected ? "O" : "X") << std::endl;
+}
+
+void ShowStreamInfo(const string& filename, const FOBJStreamOptions& Options)
+{
+	using Clock = chrono::steady_clock;
+
+	FOBJStreamStats Stats;
+	size_t NumTriangles = 0;
+
+	auto Start = Clock::now();
+
+	StreamOBJ(filename, Options, [&](const FMeshBatch& Batch)
+	{
+		NumTriangles += Batch.NumIndices / 3;
+	}, &Stats);
+
+	chrono::duration<double> Seconds = Clock::now() - Start;
+
+	std::cout << "=== OBJ Ʈ Ʈ (" << filename << ",  " << (Options.MemoryBudget >> 20) << " MB) ===" << std::endl;
+	std::cout << "ġ        : " << Stats.NumBatches << "" << std::endl;
+	std::cout << "      : " << Stats.NumVertices << "" << std::endl;
+	std::cout << " ﰢ   : " << NumTriangles << "" << std::endl;
+	std::cout << "ũ  : " << Stats.SpilledBytes / (1024.0 * 1024.0) << " MB" << std::endl;
+	std::cout << "ִ      : " << Stats.PeakResidentBytes / (1024.0 * 1024.0) << " MB" << std::endl;
+	std::cout << "ҿ ð     : " << Seconds.count() * 1000.0 << " ms" << std::endl;
+}
+
+//  ۰ ༭ v/vt/vn ũ  ϰ,      ͸,    ͸ 
+void ShowSpillFailureInfo(const string& filename)
+{
+	FOBJStreamOptions Options;
+	Options.MemoryBudget = 256 << 10;
+
+	FOBJStreamStats Stats;
+	size_t NumBatches = 0;
+
+	const bool bSpilled = StreamOBJ(filename, Options, [](const FMeshBatch&) {}, &Stats) && Stats.SpilledBytes > 0;
+
+	Options.SpillDirectory = "Data/no-such-directory";
+
+	const bool bRejected = !StreamOBJ(filename, Options, [&](const FMeshBatch&) { NumBatches++; });
+
+	std::cout << "=== OBJ Ʈ ӽ   (" << filename << ",  256 KB) ===" << std::endl;
+	std::cout << "ũ  : " << Stats.SpilledBytes / (1024.0 * 1024.0) << " MB" << std::endl;
+	std::cout << "      : " << (bSpilled && bRejected && NumBatches == 0 ? "O" : "X") << std::endl;
+}
+
+void ShowOptimizeInfo(UStaticMesh& InOutUStaticMesh)
+{
+	const size_t NumIndices = InOutUStaticMesh.Indices.size();
+
+	FMeshOptimizeStats Stats;
+	OptimizeStaticMesh(InOutUStaticMesh, &Stats);
+
+	bool bValid = InOutUStaticMesh.Indices.size() == NumIndices;
+
+	for (int Index : InOutUStaticMesh.Indices)
+	{
+		bValid = bValid && Index >= 0 && Index < static_cast<int>(InOutUStaticMesh.Vertices.size());
+	}
+
+	std::cout << "===  ĳ ȭ (ﰢ " << NumIndices / 3 << ") ===" << std::endl;
+	std::cout << "ACMR          : " << Stats.Before.ACMR << " -> " << Stats.After.ACMR << std::endl;
+	std::cout << "ATVR          : " << Stats.Before.ATVR << " -> " << Stats.After.ATVR << std::endl;
+	std::cout << "ĳ    : " << Stats.VertexCacheSeconds * 1000.0 << " ms" << std::endl;
+	std::cout << "fetch ġ  : " << Stats.VertexFetchSeconds * 1000.0 << " ms" << std::endl;
+	std::cout << "޽ ȿ     : " << (bValid ? "O" : "X") << std::endl;
+}
+
+//    ڵ  ũ ڵ   ȿ ִ Ȯ
+void ShowCompactInfo(const UStaticMesh& InUStaticMesh)
+{
+	UCompactStaticMesh Compact;
+	EncodeCompactMesh(InUStaticMesh, Compact);
+
+	float MaxAbsTexCoord = 0.0f;
+
+	for (const Vertex& v : InUStaticMesh.Vertices)
+	{
+		MaxAbsTexCoord = max({ MaxAbsTexCoord, fabsf(v.TexCoord.u), fabsf(v.TexCoord.v) });
+	}
+
+	const FCompactMeshError Error = MeasureCompactMeshError(InUStaticMesh, Compact);
+	const FCompactMeshError Bounds = GetCompactMeshErrorBounds(Compact, MaxAbsTexCoord);
+
+	const bool bPositionOk = Error.MaxPositionError <= Bounds.MaxPositionError;
+	const bool bTexCoordOk = Error.MaxTexCoordError <= Bounds.MaxTexCoordError;
+	const bool bNormalOk = Error.MaxNormalAngle <= Bounds.MaxNormalAngle;
+
+	//  BaseVertex ؼ  ε  ƾ 
+	UStaticMesh Decoded;
+	DecodeCompactMesh(Compact, Decoded);
+
+	bool bIndicesOk = Decoded.Indices == InUStaticMesh.Indices;
+
+	for (size_t i = 0; bIndicesOk && i < InUStaticMesh.Indices.size(); i++)
+	{
+		bIndicesOk = Compact.GetIndex(i) == static_cast<uint32_t>(InUStaticMesh.Indices[i]);
+	}
+
+	const size_t OriginalSize = InUStaticMesh.Vertices.size() * sizeof(Vertex) + InUStaticMesh.Indices.size() * sizeof(int);
+	const double RadToDeg = 180.0 / 3.14159265358979;
+
+	std::cout << "===    ( " << InUStaticMesh.Vertices.size() << ", " << (Compact.Uses16BitIndices() ? 16 : 32) << "Ʈ ε,  " << Compact.IndexRanges.size() << ") ===" << std::endl;
+	std::cout << "ũ          : " << OriginalSize << " -> " << Compact.GetDataSize() << " Ʈ (" << 100.0 * Compact.GetDataSize() / max<size_t>(1, OriginalSize) << "%)" << std::endl;
+	std::cout << "ġ      : " << Error.MaxPositionError << " ( " << Bounds.MaxPositionError << ") " << (bPositionOk ? "O" : "X") << std::endl;
+	std::cout << "UV        : " << Error.MaxTexCoordError << " ( " << Bounds.MaxTexCoordError << ") " << (bTexCoordOk ? "O" : "X") << std::endl;
+	std::cout << "  : " << Error.MaxNormalAngle * RadToDeg << " ( " << Bounds.MaxNormalAngle * RadToDeg << ") " << (bNormalOk ? "O" : "X") << std::endl;
+	std::cout << "ε    : " << (bIndicesOk ? "O" : "X") << std::endl;
+}
+
+// vn  ޽ 䳻:  ε  
+static void StripNormals(FStaticMesh& InOutFStaticMesh)
+{
+	InOutFStaticMesh.Normals.clear();
+
+	for (FFaceCorner& Corner : InOutFStaticMesh.Corners)
+	{
+		Corner.Normal = -1;
+	}
+}
+
+//   ޽ (+ ) ð Ľ ð ϰ,  /źƮ   󸶳 ٸ Ȯ
+void ShowNormalInfo(const string& filename)
+{
+	using Clock = chrono::steady_clock;
+
+	FStaticMesh FSM;
+
+	auto ParseStart = Clock::now();
+	ParseOBJParallel(filename, FSM);
+	chrono::duration<double> ParseSeconds = Clock::now() - ParseStart;
+
+	UStaticMesh Reference;
+	BuildStaticMesh(FSM, Reference);
+
+	StripNormals(FSM);
+
+	UStaticMesh Generated;
+
+	auto BuildStart = Clock::now();
+	BuildStaticMesh(FSM, Generated);
+	chrono::duration<double> BuildSeconds = Clock::now() - BuildStart;
+
+	auto TangentStart = Clock::now();
+	GenerateTangents(Generated);
+	chrono::duration<double> TangentSeconds = Clock::now() - TangentStart;
+
+	//   ﰢ  Ƿ  ٷ 
+	//       vn ¸ ݴ  Ƿ (apple_mid  ݴ)
+	//  -  񱳴   |dot|,  vn  ݴ ﰢ   
+	//  -     ǹǷ   ( ) ݴ ﰢ  
+	//     ﰢ   ȣ  ¿ǹǷ  
+	double SumAngle = 0.0;
+	float MaxAngle = 0.0f;
+	size_t NumTriangles = 0;
+	size_t ReferenceFlipped = 0;
+	size_t GeneratedFlipped = 0;
+	const bool bSameCorners = Reference.Indices.size() == Generated.Indices.size();
+
+	for (size_t t = 0; bSameCorners && t + 2 < Generated.Indices.size(); t += 3)
+	{
+		const FVector& P0 = Generated.Vertices[Generated.Indices[t]].Location;
+		const FVector& P1 = Generated.Vertices[Generated.Indices[t + 1]].Location;
+		const FVector& P2 = Generated.Vertices[Generated.Indices[t + 2]].Location;
+		const FVector E1(P1.x - P0.x, P1.y - P0.y, P1.z - P0.z);
+		const FVector E2(P2.x - P0.x, P2.y - P0.y, P2.z - P0.z);
+		const FVector FaceNormal = Cross(E1, E2);
+		const bool bDegenerate = Dot(FaceNormal, FaceNormal) <= 1e-12f * Dot(E1, E1) * Dot(E2, E2);
+
+		FVector ReferenceSum, GeneratedSum;
+
+		for (size_t i = t; i < t + 3; i++)
+		{
+			const FVector A = NormalizeOr(Reference.Vertices[Reference.Indices[i]].Normal, FVector());
+			const FVector& B = Generated.Vertices[Generated.Indices[i]].Normal;
+			const float Angle = acosf(min(1.0f, fabsf(Dot(A, B))));
+
+			SumAngle += Angle;
+			MaxAngle = max(MaxAngle, Angle);
+
+			ReferenceSum = FVector(ReferenceSum.x + A.x, ReferenceSum.y + A.y, ReferenceSum.z + A.z);
+			GeneratedSum = FVector(GeneratedSum.x + B.x, GeneratedSum.y + B.y, GeneratedSum.z + B.z);
+		}
+
+		if (!bDegenerate)
+		{
+			NumTriangles++;
+			ReferenceFlipped += Dot(FaceNormal, ReferenceSum) < 0.0f ? 1 : 0;
+			GeneratedFlipped += Dot(FaceNormal, GeneratedSum) < 0.0f ? 1 : 0;
+		}
+	}
+
+	bool bUnitNormals = true;
+	bool bOrthonormalTangents = Generated.Tangents.size() == Generated.Vertices.size();
+
+	for (size_t v = 0; v < Generated.Vertices.size(); v++)
+	{
+		const FVector& N = Generated.Vertices[v].Normal;
+		bUnitNormals = bUnitNormals && fabsf(Dot(N, N) - 1.0f) < 1e-4f;
+
+		if (bOrthonormalTangents)
+		{
+			const FTangent& T = Generated.Tangents[v];
+			bOrthonormalTangents = fabsf(Dot(T.Direction, T.Direction) - 1.0f) < 1e-4f && fabsf(Dot(T.Direction, N)) < 1e-3f && fabsf(T.BitangentSign) == 1.0f;
+		}
+	}
+
+	const double RadToDeg = 180.0 / 3.14159265358979;
+	const size_t NumCorners = max<size_t>(1, Generated.Indices.size());
+
+	std::cout << "=== /źƮ  (" << filename << ", Ŀ " << FThreadPool::Get().Num() << ", " << (SIMD_SSE2 ? "SSE2" : "Į") << ") ===" << std::endl;
+	std::cout << "Ľ          : " << ParseSeconds.count() * 1000.0 << " ms" << std::endl;
+	std::cout << "+     : " << BuildSeconds.count() * 1000.0 << " ms" << std::endl;
+	std::cout << "źƮ        : " << TangentSeconds.count() * 1000.0 << " ms" << std::endl;
+	std::cout << "  :  " << SumAngle / NumCorners * RadToDeg << ", ִ " << MaxAngle * RadToDeg << " ( )" << std::endl;
+	std::cout << " ݴ   :  vn " << ReferenceFlipped << ",  " << GeneratedFlipped << " / ﰢ " << NumTriangles << "" << std::endl;
+	std::cout << "  ġ /    : " << (bSameCorners && NumTriangles > 0 && MaxAngle * RadToDeg < 5.0 && GeneratedFlipped * 1000 <= NumTriangles ? "O" : "X") << std::endl;
+	std::cout << "      : " << (bUnitNormals ? "O" : "X") << std::endl;
+	std::cout << "źƮ    : " << (bOrthonormalTangents ? "O" : "X") << std::endl;
+}
+
+// ťó 𼭸 īο ޽ÿ smoothing angle Ʒδ     ״  Ȯ
+void ShowSmoothingSplitInfo(const string& filename)
+{
+	FStaticMesh FSM;
+
+	ParseOBJParallel(filename, FSM);
+	StripNormals(FSM);
+
+	UStaticMesh Smooth;
+	BuildStaticMesh(FSM, Smooth);
+
+	UStaticMesh Split = Smooth;
+	FNormalOptions Options;
+	Options.SmoothingAngleDegrees = 30.0f;
+
+	GenerateNormals(Split, Options);
+	GenerateTangents(Split);
+
+	bool bFaceNormals = true;
+	bool bTangentsAlongU = true;
+
+	for (size_t i = 0; i + 2 < Split.Indices.size(); i += 3)
+	{
+		const Vertex& A = Split.Vertices[Split.Indices[i]];
+		const Vertex& B = Split.Vertices[Split.Indices[i + 1]];
+		const Vertex& C = Split.Vertices[Split.Indices[i + 2]];
+
+		const FVector E1(B.Location.x - A.Location.x, B.Location.y - A.Location.y, B.Location.z - A.Location.z);
+		const FVector E2(C.Location.x - A.Location.x, C.Location.y - A.Location.y, C.Location.z - A.Location.z);
+		const FVector FaceNormal = NormalizeOr(Cross(E1, E2), FVector());
+
+		for (int c = 0; c < 3; c++)
+		{
+			const int v = Split.Indices[i + c];
+			bFaceNormals = bFaceNormals && Dot(Split.Vertices[v].Normal, FaceNormal) > 0.9999f;
+		}
+
+		// V  ʴ 𼭸 U þ  źƮ ̾ 
+		const Vertex* Corners[3] = { &A, &B, &C };
+
+		for (int e = 0; e < 3; e++)
+		{
+			const Vertex& From = *Corners[e];
+			const Vertex& To = *Corners[(e + 1) % 3];
+			const float DU = To.TexCoord.u - From.TexCoord.u;
+			const float DV = To.TexCoord.v - From.TexCoord.v;
+
+			if (fabsf(DV) > 1e-6f || fabsf(DU) < 1e-6f)
+			{
+				continue;
+			}
+
+			const float Sign = (DU > 0.0f) ? 1.0f : -1.0f;
+			const FVector AlongU = NormalizeOr(FVector((To.Location.x - From.Location.x) * Sign, (To.Location.y - From.Location.y) * Sign, (To.Location.z - From.Location.z) * Sign), FVector());
+
+			for (int c = 0; c < 3; c++)
+			{
+				bTangentsAlongU = bTangentsAlongU && Dot(Split.Tangents[Split.Indices[i + c]].Direction, AlongU) > 0.9999f;
+			}
+		}
+	}
+
+	std::cout << "=== Smoothing angle  (" << filename << ", " << Options.SmoothingAngleDegrees << ") ===" << std::endl;
+	std::cout << "        : " << Smooth.Vertices.size() << " -> " << Split.Vertices.size() << "" << std::endl;
+	std::cout << "  ġ  : " << (bFaceNormals ? "O" : "X") << std::endl;
+	std::cout << "źƮ    : " << (bTangentsAlongU ? "O" : "X") << std::endl;
+}
+
+// û  LOD  ﰢ /  ð ϰ ε/ ȿ Ȯ
+// bReducible̸ LOD ǥ ﰢ  Ϸ پ, ƴϸ(  ޽)  ﰢ  ״ ߴ Ȯ
+void ShowLODInfo(const UStaticMesh& InUStaticMesh, bool bReducible)
+{
+	using Clock = chrono::steady_clock;
+
+	const size_t NumTriangles = InUStaticMesh.Indices.size() / 3;
+	vector<FStaticMeshLOD> LODs;
+
+	auto Start = Clock::now();
+	GenerateLODChain(InUStaticMesh, { 0.5f, 0.25f, 0.1f }, LODs);
+	chrono::duration<double> Seconds = Clock::now() - Start;
+
+	std::cout << "=== LOD ü (ﰢ " << NumTriangles << ", Ŀ " << FThreadPool::Get().Num() << ") ===" << std::endl;
+	std::cout << " ð     : " << Seconds.count() * 1000.0 << " ms" << std::endl;
+
+	for (size_t l = 0; l < LODs.size(); l++)
+	{
+		const FStaticMeshLOD& LOD = LODs[l];
+
+		bool bValid = LOD.Indices.size() % 3 == 0;
+		uint32_t SectionIndices = 0;
+
+		for (int Index : LOD.Indices)
+		{
+			bValid = bValid && Index >= 0 && Index < static_cast<int>(InUStaticMesh.Vertices.size());
+		}
+
+		for (const FStaticMeshSection& Section : LOD.Sections)
+		{
+			bValid = bValid && Section.FirstIndex == SectionIndices;
+			SectionIndices += Section.NumIndices;
+		}
+
+		bValid = bValid && SectionIndices == LOD.Indices.size();
+
+		// GenerateLODChain   ǥ ﰢ  
+		const size_t LODTriangles = LOD.Indices.size() / 3;
+		const size_t TargetTriangles = static_cast<size_t>(LOD.TargetRatio * NumTriangles);
+		const bool bCount = bReducible ? LODTriangles <= TargetTriangles : LODTriangles == NumTriangles;
+
+		std::cout << "LOD" << l + 1 << " (" << LOD.TargetRatio * 100.0f << "%)  : ﰢ " << LODTriangles
+			<< " (" << (bReducible ? "ǥ " + to_string(TargetTriangles) + " " : "   ޽,  ") << "),  " << LOD.Error
+			<< " (밢 " << LOD.RelativeError * 100.0f << "%) " << (bValid && bCount ? "O" : "X") << std::endl;
+	}
+}
+
+// ٿ ڽ ۿ ڽ    ϴ  //ü  ӵ , Ϻδ  ˻ 
+void ShowBVHInfo(const UStaticMesh& InUStaticMesh)
+{
+	using Clock = chrono::steady_clock;
+
+	FMeshBVH BVH;
+
+	auto BuildStart = Clock::now();
+	BVH.Build(InUStaticMesh);
+	chrono::duration<double> BuildSeconds = Clock::now() - BuildStart;
+
+	std::cout << "=== BVH (ﰢ " << BVH.NumTriangles() << ", Ŀ " << FThreadPool::Get().Num() << ", " << (SIMD_SSE2 ? "SSE2" : "Į") << ") ===" << std::endl;
+
+	if (BVH.NumTriangles() == 0)
+	{
+		return;
+	}
+
+	const FBox& Bounds = BVH.GetBounds();
+	const FVector Center = Bounds.Center();
+	const FVector Extent(Bounds.Max.x - Bounds.Min.x, Bounds.Max.y - Bounds.Min.y, Bounds.Max.z - Bounds.Min.z);
+	const float Radius = max(1e-6f, 0.5f * sqrtf(Dot(Extent, Extent)));
+
+	mt19937 Random(12345);
+	uniform_real_distribution<float> Unit(-1.0f, 1.0f);
+
+	auto RandomInBox = [&]()
+	{
+		return FVector(Center.x + Unit(Random) * Extent.x * 0.5f, Center.y + Unit(Random) * Extent.y * 0.5f, Center.z + Unit(Random) * Extent.z * 0.5f);
+	};
+
+	auto RandomOnSphere = [&]()
+	{
+		const FVector D = NormalizeOr(FVector(Unit(Random), Unit(Random), Unit(Random)), FVector(0, 0, 1));
+		return FVector(Center.x + D.x * Radius * 2.0f, Center.y + D.y * Radius * 2.0f, Center.z + D.z * Radius * 2.0f);
+	};
+
+	//    (ĳÿ Ҹ )
+	const size_t NumRays = 1 << 18;
+	vector<FRay> Rays(NumRays);
+
+	for (FRay& Ray : Rays)
+	{
+		Ray.Origin = RandomOnSphere();
+		const FVector Target = RandomInBox();
+		Ray.Direction = FVector(Target.x - Ray.Origin.x, Target.y - Ray.Origin.y, Target.z - Ray.Origin.z);
+	}
+
+	//   ڷ  ī޶  ( ȸ  )
+	const int GridSize = 512;
+	vector<FRay> CameraRays(GridSize * GridSize);
+	const FVector Eye(Center.x, Center.y, Center.z + Radius * 2.0f);
+
+	for (int y = 0; y < GridSize; y++)
+	{
+		for (int x = 0; x < GridSize; x++)
+		{
+			//  32 8x4 Ÿ ǵ ġ
+			const int Tile = (y / 4) * (GridSize / 8) + x / 8;
+			FRay& Ray = CameraRays[Tile * 32 + (y % 4) * 8 + x % 8];
+
+			Ray.Origin = Eye;
+			Ray.Direction = FVector((x + 0.5f) / GridSize - 0.5f, (y + 0.5f) / GridSize - 0.5f, -1.0f);
+		}
+	}
+
+	vector<FRayHit> Hits(NumRays);
+	vector<FRayHit> CameraHits(CameraRays.size());
+	vector<FRayHit> PacketHits(CameraRays.size());
+
+	auto Start = Clock::now();
+
+	for (size_t r = 0; r < NumRays; r++)
+	{
+		BVH.Intersect(Rays[r], Hits[r]);
+	}
+
+	chrono::duration<double> SingleSeconds = Clock::now() - Start;
+
+	Start = Clock::now();
+	size_t NumOccluded = 0;
+
+	for (size_t r = 0; r < NumRays; r++)
+	{
+		NumOccluded += BVH.IntersectAny(Rays[r]) ? 1 : 0;
+	}
+
+	chrono::duration<double> AnySeconds = Clock::now() - Start;
+
+	Start = Clock::now();
+
+	for (size_t r = 0; r < CameraRays.size(); r++)
+	{
+		BVH.Intersect(CameraRays[r], CameraHits[r]);
+	}
+
+	chrono::duration<double> CameraSeconds = Clock::now() - Start;
+
+	Start = Clock::now();
+	BVH.IntersectPacket(CameraRays.data(), PacketHits.data(), CameraRays.size());
+	chrono::duration<double> PacketSeconds = Clock::now() - Start;
+
+	// ֱ: ǥ ó(   5% ) 
+	const size_t NumPoints = 1 << 16;
+	vector<FVector> Points(NumPoints);
+	vector<FClosestPoint> Closest(NumPoints);
+	uniform_int_distribution<size_t> AnyVertex(0, InUStaticMesh.Vertices.size() - 1);
+
+	for (FVector& P : Points)
+	{
+		const FVector& Near = InUStaticMesh.Vertices[AnyVertex(Random)].Location;
+		P = FVector(Near.x + Unit(Random) * Radius * 0.05f, Near.y + Unit(Random) * Radius * 0.05f, Near.z + Unit(Random) * Radius * 0.05f);
+	}
+
+	Start = Clock::now();
+
+	for (size_t p = 0; p < NumPoints; p++)
+	{
+		BVH.FindClosestPoint(Points[p], INFINITY, Closest[p]);
+	}
+
+	chrono::duration<double> ClosestSeconds = Clock::now() - Start;
+
+	//  ˻  (Ϻθ)
+	vector<FBVHTriangle> AllTriangles(InUStaticMesh.Indices.size() / 3);
+
+	for (size_t t = 0; t < AllTriangles.size(); t++)
+	{
+		const FVector& A = InUStaticMesh.Vertices[InUStaticMesh.Indices[t * 3 + 0]].Location;
+		const FVector& B = InUStaticMesh.Vertices[InUStaticMesh.Indices[t * 3 + 1]].Location;
+		const FVector& C = InUStaticMesh.Vertices[InUStaticMesh.Indices[t * 3 + 2]].Location;
+
+		AllTriangles[t] = { A, FVector(B.x - A.x, B.y - A.y, B.z - A.z), FVector(C.x - A.x, C.y - A.y, C.z - A.z), static_cast<uint32_t>(t) };
+	}
+
+	bool bRaysMatch = true;
+	bool bPacketMatch = true;
+	bool bClosestMatch = true;
+
+	for (size_t r = 0; r < 256; r++)
+	{
+		float BestT = INFINITY, T, U, V;
+
+		for (const FBVHTriangle& Triangle : AllTriangles)
+		{
+			BestT = IntersectTriangle(Triangle, Rays[r], BestT, T, U, V) ? T : BestT;
+		}
+
+		bRaysMatch = bRaysMatch && (BestT == Hits[r].T) && (Hits[r].IsHit() == BVH.IntersectAny(Rays[r]));
+	}
+
+	for (size_t r = 0; r < CameraRays.size(); r++)
+	{
+		bPacketMatch = bPacketMatch && PacketHits[r].T == CameraHits[r].T && PacketHits[r].Triangle == CameraHits[r].Triangle;
+	}
+
+	for (size_t p = 0; p < 64; p++)
+	{
+		float Best = INFINITY;
+
+		for (const FBVHTriangle& Triangle : AllTriangles)
+		{
+			const FVector Q = ClosestPointOnTriangle(Points[p], Triangle);
+			const FVector D(Q.x - Points[p].x, Q.y - Points[p].y, Q.z - Points[p].z);
+			Best = min(Best, Dot(D, D));
+		}
+
+		bClosestMatch = bClosestMatch && Best == Closest[p].DistanceSquared;
+	}
+
+	auto Rate = [](size_t Count, const chrono::duration<double>& Seconds)
+	{
+		return Count / max(1e-9, Seconds.count()) / 1e6;
+	};
+
+	std::cout << "          : " << BuildSeconds.count() * 1000.0 << " ms ( " << BVH.NumNodes() << ", " << BVH.GetDataSize() / 1024 << " KB)" << std::endl;
+	std::cout << "      : " << Rate(NumRays, SingleSeconds) << " M/s (ü " << Rate(NumRays, AnySeconds) << " M/s,  " << NumOccluded << ")" << std::endl;
+	std::cout << "ī޶    : " << Rate(CameraRays.size(), CameraSeconds) << " M/s ( " << Rate(CameraRays.size(), PacketSeconds) << " M/s)" << std::endl;
+	std::cout << "ֱ      : " << Rate(NumPoints, ClosestSeconds) << " M/s" << std::endl;
+	std::cout << " ˻ ġ:  " << (bRaysMatch ? "O" : "X") << ",  " << (bPacketMatch ? "O" : "X") << ", ֱ " << (bClosestMatch ? "O" : "X") << std::endl;
+}
+
+// ڷ  νϽ(ȸ/ũ )  ī޶ øϰ,   Į   
+void ShowCullingInfo(const UStaticMesh& InUStaticMesh, size_t NumInstances)
+{
+	using Clock = chrono::steady_clock;
+
+	const FBox& Bounds = InUStaticMesh.Bounds;
+
+	std::cout << "=== ü ø (νϽ " << NumInstances << ", Ŀ " << FThreadPool::Get().Num() << ", " << (SIMD_SSE2 ? "SSE2" : "Į") << ") ===" << std::endl;
+
+	if (Bounds.IsEmpty())
+	{
+		return;
+	}
+
+	const float Spacing = max(1e-3f, InUStaticMesh.BoundingSphere.Radius * 3.0f);
+	const size_t Columns = 512;
+
+	vector<FMatrix> WorldMatrices(NumInstances);
+	mt19937 Random(7);
+	uniform_real_distribution<float> Unit(0.0f, 1.0f);
+
+	for (size_t i = 0; i < NumInstances; i++)
+	{
+		const float Angle = Unit(Random) * 6.2831853f;
+		const float Scale = 0.5f + Unit(Random);
+		FMatrix& World = WorldMatrices[i];
+
+		// Y ȸ x յ ũ + ̵ (  Ծ: ̵  )
+		World.M[0][0] = cosf(Angle) * Scale;	World.M[0][2] = sinf(Angle) * Scale;
+		World.M[1][1] = Scale;
+		World.M[2][0] = -sinf(Angle) * Scale;	World.M[2][2] = cosf(Angle) * Scale;
+		World.M[0][3] = (static_cast<float>(i % Columns) - Columns * 0.5f) * Spacing;
+		World.M[2][3] = static_cast<float>(i / Columns) * Spacing;
+	}
+
+	//    +z  ī޶ (þ߰ 60,  0..w)
+	const FMatrix View = FMatrix::Translation(FVector(0.0f, -Spacing * 5.0f, Spacing * 10.0f));
+	const FMatrix Projection = FMatrix::Perspective(60.0f * 3.14159265f / 180.0f, 16.0f / 9.0f, Spacing * 0.1f, Spacing * 200.0f);
+	const FMatrix ViewProjection = Projection * View;
+
+	vector<uint64_t> Visible;
+	const int NumRuns = 20;
+
+	CullInstances(Bounds, WorldMatrices.data(), NumInstances, ViewProjection, Visible);
+
+	auto Start = Clock::now();
+
+	for (int Run = 0; Run < NumRuns; Run++)
+	{
+		CullInstances(Bounds, WorldMatrices.data(), NumInstances, ViewProjection, Visible);
+	}
+
+	chrono::duration<double> Seconds = Clock::now() - Start;
+
+	// Į :  AABB(Arvo) 鸶 ˻
+	const FFrustum Frustum = FFrustum::FromViewProjection(ViewProjection);
+	const FVector C = Bounds.Center();
+	const FVector E = Bounds.Extent();
+	size_t NumVisible = 0;
+	bool bMatch = true;
+
+	for (size_t i = 0; i < NumInstances; i++)
+	{
+		const float (&M)[4][4] = WorldMatrices[i].M;
+		float Center[3], Extent[3];
+
+		for (int r = 0; r < 3; r++)
+		{
+			Center[r] = M[r][0] * C.x + M[r][1] * C.y + M[r][2] * C.z + M[r][3];
+			Extent[r] = fabsf(M[r][0]) * E.x + fabsf(M[r][1]) * E.y + fabsf(M[r][2]) * E.z;
+		}
+
+		bool bInside = true;
+
+		for (const float* Plane : Frustum.Planes)
+		{
+			const float Distance = Plane[0] * Center[0] + Plane[1] * Center[1] + Plane[2] * Center[2] + Plane[3];
+			const float Radius = fabsf(Plane[0]) * Extent[0] + fabsf(Plane[1]) * Extent[1] + fabsf(Plane[2]) * Extent[2];
+
+			bInside = bInside && Distance + Radius >= 0.0f;
+		}
+
+		NumVisible += IsVisible(Visible, i) ? 1 : 0;
+		bMatch = bMatch && bInside == IsVisible(Visible, i);
+	}
+
+	std::cout << "ø          : " << Seconds.count() * 1000.0 / NumRuns << " ms" << std::endl;
+	std::cout << "̴ νϽ: " << NumVisible << "" << std::endl;
+	std::cout << "Į ġ : " << (bMatch ? "O" : "X") << std::endl;
+}
+void ShowTextureCacheInfo(const string& Directory)
+{
+	std::cout << "=== ؽó ĳ (" << Directory << ") ===" << std::endl;
+
+	const char* Libraries[] = { "apple_mid.mtl", "bitten_apple_mid.mtl", "cube-tex.mtl" };
+	vector<MtlMaterial> Materials;
+
+	for (const char* Library : Libraries)
+	{
+		vector<MtlMaterial> LibraryMaterials;
+
+		if (LoadMaterials((filesystem::path(Directory) / Library).generic_string(), LibraryMaterials))
+		{
+			Materials.insert(Materials.end(), LibraryMaterials.begin(), LibraryMaterials.end());
+		}
+	}
+
+	auto PrintStats = [](const char* Label, const FTextureCacheStats& Stats)
+	{
+		std::cout << Label << ":  " << Stats.NumTextures << " " << Stats.ResidentBytes / 1024 << " KB /  " << Stats.BudgetBytes / 1024
+			<< " KB,  " << Stats.Hits << ", ̽ " << Stats.Misses << ",  " << Stats.Evictions << " (" << Stats.EvictedBytes / 1024 << " KB)" << std::endl;
+	};
+
+	FTextureCache Cache(4 << 20);
+
+	//      û:  °  ϰ  ͸ Ѿ 
+	vector<FTextureHandle> First, Second;
+
+	for (const MtlMaterial& Material : Materials)
+	{
+		Cache.RequestMaterialTextures(Material, Directory, First);
+	}
+
+	for (const MtlMaterial& Material : Materials)
+	{
+		Cache.RequestMaterialTextures(Material, Directory, Second);
+	}
+
+	bool bShared = First.size() == Second.size();
+	size_t NumLoaded = 0;
+
+	for (size_t i = 0; bShared && i < First.size(); i++)
+	{
+		const FTexture* A = First[i].Wait();
+		const FTexture* B = Second[i].Wait();
+
+		bShared = A == B;
+		NumLoaded += A ? 1 : 0;
+	}
+
+	//  ǥⰡ ޶ ȭ   ׸
+	FTextureHandle Alias = Cache.Request(Directory + "/./cube_texture.png");
+	const bool bAlias = Alias.GetPath() == FName((filesystem::path(Directory) / "cube_texture.png").generic_string());
+	Alias.Reset();
+
+	PrintStats("ε       ", Cache.GetStats());
+
+	//  ٿ ڵ  ִ ؽó  ־ 
+	Cache.SetBudget(1 << 20);
+	const FTextureCacheStats Pinned = Cache.GetStats();
+	PrintStats(" 1 MB    ", Pinned);
+
+	// ڵ  ϸ   
+	First.clear();
+	Second.clear();
+	const FTextureCacheStats Released = Cache.GetStats();
+	PrintStats("ڵ   ", Released);
+
+	//  ؽó ٽ ûϸ ٽ ε
+	FTextureHandle Again = Cache.Request((filesystem::path(Directory) / Materials[0].map_Kd).generic_string());
+	const bool bReloaded = Again.Wait() != nullptr;
+	const FTextureCacheStats Reloaded = Cache.GetStats();
+	Again.Reset();
+
+	// ڴ ܸ  Wait  ʰ (nullptr) ָ,  ׸  ʾƼ ٽ ûϸ ٽ ڵ
+	bool bThrowRecovered = false;
+
+	{
+		atomic<int> NumDecodes{ 0 };
+		FTextureCache ThrowingCache(1 << 20, [&NumDecodes](const string&, FTexture&) -> bool
+		{
+			NumDecodes++;
+			throw runtime_error("decode failed");
+		});
+
+		FTextureHandle Failed = ThrowingCache.Request(Directory + "/broken.ppm");
+		const bool bFailedWait = Failed.Wait() == nullptr;
+		Failed.Reset();
+
+		FTextureHandle Retry = ThrowingCache.Request(Directory + "/broken.ppm");
+		const bool bRetryFailed = Retry.Wait() == nullptr;
+		const FTextureCacheStats ThrowStats = ThrowingCache.GetStats();
+		Retry.Reset();
+
+		bThrowRecovered = bFailedWait && bRetryFailed && NumDecodes == 2 && ThrowStats.Misses == 2 && ThrowStats.FailedLoads == 2 && ThrowStats.NumTextures == 0;
+	}
+
+	std::cout << "ؽó " << NumLoaded << " ε,  ° û  ؽó  : " << (bShared && bAlias && NumLoaded > 0 ? "O" : "X") << std::endl;
+	std::cout << "  ؽó  Ѿ  : " << (Pinned.Evictions == 0 && Pinned.NumTextures == NumLoaded ? "O" : "X") << std::endl;
+	std::cout << "   Ϸ  : " << (Released.ResidentBytes <= Released.BudgetBytes && Released.Evictions > 0 ? "O" : "X") << std::endl;
+	std::cout << " ؽó û  ٽ ε : " << (bReloaded && Reloaded.Misses == Released.Misses + 1 ? "O" : "X") << std::endl;
+	std::cout << "ڴ    ȯ, ĳÿ   : " << (bThrowRecovered ? "O" : "X") << std::endl;
+}
+
+void ShowMipInfo(uint32_t Size)
+{
+	using Clock = chrono::steady_clock;
+
+	std::cout << "===  ü (" << Size << "x" << Size << ", Ŀ " << FThreadPool::Get().Num() << ", " << (SIMD_SSE2 ? "SSE2" : "Į") << ") ===" << std::endl;
+
+	// / ׶Ʈ + 1ȼ  üĿ(B) +  
+	FTexture Base;
+	Base.Format = ETextureFormat::RGBA8;
+	Base.Width = Size;
+	Base.Height = Size;
+	Base.Data.resize(static_cast<size_t>(Size) * Size * 4);
+
+	for (uint32_t y = 0; y < Size; y++)
+	{
+		for (uint32_t x = 0; x < Size; x++)
+		{
+			uint8_t* p = &Base.Data[(static_cast<size_t>(y) * Size + x) * 4];
+
+			p[0] = static_cast<uint8_t>(x * 255 / (Size - 1));
+			p[1] = static_cast<uint8_t>(y * 255 / (Size - 1));
+			p[2] = ((x ^ y) & 1) ? 255 : 0;
+			p[3] = static_cast<uint8_t>((x + y) & 255);
+		}
+	}
+
+	vector<FTexture> Mips;
+	const int NumRuns = 5;
+
+	auto Start = Clock::now();
+
+	for (int Run = 0; Run < NumRuns; Run++)
+	{
+		GenerateMipChain(Base, Mips);
+	}
+
+	chrono::duration<double> Seconds = Clock::now() - Start;
+
+	// Į : pow  ȯ  2x2 
+	auto ToLinear = [](uint8_t v) { const float c = v / 255.0f; return c <= 0.04045f ? c / 12.92f : powf((c + 0.055f) / 1.055f, 2.4f); };
+	auto ToSrgb = [](float l) { const float c = l <= 0.0031308f ? l * 12.92f : 1.055f * powf(l, 1.0f / 2.4f) - 0.055f; return static_cast<int>(c * 255.0f + 0.5f); };
+
+	const FTexture& Level1 = Mips[1];
+	int MaxError = 0;
+
+	for (uint32_t y = 0; y < Level1.Height; y++)
+	{
+		for (uint32_t x = 0; x < Level1.Width; x++)
+		{
+			for (int c = 0; c < 4; c++)
+			{
+				float Sum = 0.0f;
+
+				for (uint32_t dy = 0; dy < 2; dy++)
+				{
+					for (uint32_t dx = 0; dx < 2; dx++)
+					{
+						const uint8_t v = Base.Data[((static_cast<size_t>(2 * y + dy)) * Size + 2 * x + dx) * 4 + c];
+						Sum += c < 3 ? ToLinear(v) : v / 255.0f;
+					}
+				}
+
+				const int Expected = c < 3 ? ToSrgb(Sum * 0.25f) : static_cast<int>(Sum * 0.25f * 255.0f + 0.5f);
+				MaxError = max(MaxError, abs(Expected - static_cast<int>(Level1.Data[(static_cast<size_t>(y) * Level1.Width + x) * 4 + c])));
+			}
+		}
+	}
+
+	//  üĿ   0.5 = sRGB 188 ( ϸ 128)
+	const int CheckerMip = Mips[1].Data[2];
+
+	// Ȧ ũ (5x3 -> 2x1):  /  ʰ ڸ  ؼ տ  (  )
+	bool bOddEdges = true;
+
+	{
+		FTexture Odd, OddMip;
+		Odd.Format = ETextureFormat::RGBA8;
+		Odd.Width = 5;
+		Odd.Height = 3;
+		Odd.Data.resize(5 * 3 * 4);
+
+		for (size_t i = 0; i < Odd.Data.size(); i++)
+		{
+			const size_t x = (i / 4) % 5, y = (i / 4) / 5;
+			Odd.Data[i] = static_cast<uint8_t>(x * 60 + y * 10 + (i % 4));
+		}
+
+		DownsampleMip(Odd, OddMip, false);
+
+		bOddEdges = OddMip.Width == 2 && OddMip.Height == 1;
+
+		for (uint32_t x = 0; bOddEdges && x < 2; x++)
+		{
+			const uint32_t FirstColumn = 2 * x;
+			const uint32_t NumColumns = (x == 1) ? 3 : 2;
+
+			for (int c = 0; c < 4; c++)
+			{
+				float Sum = 0.0f;
+
+				for (uint32_t y = 0; y < 3; y++)
+				{
+					for (uint32_t dx = 0; dx < NumColumns; dx++)
+					{
+						Sum += Odd.Data[((y * 5) + FirstColumn + dx) * 4 + c];
+					}
+				}
+
+				bOddEdges = bOddEdges && abs(static_cast<int>(Sum / (3 * NumColumns) + 0.5f) - OddMip.Data[x * 4 + c]) <= 1;
+			}
+		}
+	}
+
+	//  ü Ϸ   ȭ ũ⺰ ʿ Ӹ Ʈ
+	const string MipPath = (filesystem::temp_directory_path() / "FeatureTest_mips.cooked").generic_string();
+	const string PPMPath = (filesystem::temp_directory_path() / "FeatureTest_base.ppm").generic_string();
+
+	bool bStreamed = SaveMipChain(MipPath, Mips, true);
+	FStreamedTexture Streamed;
+	bStreamed = bStreamed && Streamed.Open(MipPath);
+
+	std::cout << "          : " << Seconds.count() * 1000.0 / NumRuns << " ms (" << Mips.size() << ")" << std::endl;
+	std::cout << "pow  ִ  : " << MaxError << " (üĿ  " << CheckerMip << ")" << std::endl;
+
+	const size_t FullBytes = Streamed.GetFullChainBytes();
+	bool bOnDemand = bStreamed;
+
+	for (float ScreenPixels : { 64.0f, 300.0f, 1200.0f })
+	{
+		const uint32_t FirstMip = SelectMipForScreenSize(Size, Size, ScreenPixels, Streamed.GetNumMips());
+		Streamed.RequestMips(FirstMip);
+
+		const FTexture* Mip = Streamed.GetMip(FirstMip);
+		bOnDemand = bOnDemand && Mip && Mip->Data == Mips[FirstMip].Data && Streamed.GetMip(FirstMip - 1) == nullptr;
+
+		std::cout << "ȭ " << ScreenPixels << "px ->  " << FirstMip << " : " << Streamed.GetResidentBytes() / 1024 << " KB / ü " << FullBytes / 1024
+			<< " KB (" << static_cast<double>(FullBytes) / max<size_t>(1, Streamed.GetResidentBytes()) << " )" << std::endl;
+	}
+
+	// ٽ ־   
+	Streamed.RequestMips(5);
+	bOnDemand = bOnDemand && Streamed.GetMip(4) == nullptr && Streamed.GetResidentBytes() < FullBytes / 64;
+
+	// PPM ؽó ĳ ڴ ٷ   
+	bool bPPM = SavePPM(PPMPath, Base);
+
+	{
+		FTextureCache Cache(64 << 20, LoadPPM);
+		FTextureHandle Handle = Cache.Request(PPMPath);
+		const FTexture* Loaded = Handle.Wait();
+
+		bPPM = bPPM && Loaded && Loaded->Format == ETextureFormat::RGBA8 && Loaded->Width == Size && Loaded->Height == Size;
+
+		for (size_t i = 0; bPPM && i < Loaded->Data.size(); i++)
+		{
+			bPPM = Loaded->Data[i] == ((i % 4 == 3) ? 255 : Base.Data[i]);
+		}
+	}
+
+	filesystem::remove(MipPath);
+	filesystem::remove(PPMPath);
+
+	std::cout << "pow ذ 1 ̳ /    : " << (MaxError <= 1 && abs(CheckerMip - 188) <= 1 ? "O" : "X") << std::endl;
+	std::cout << "Ȧ ũ ڸ  : " << (bOddEdges ? "O" : "X") << std::endl;
+	std::cout << "ʿ Ӹ ,  о  : " << (bOnDemand ? "O" : "X") << std::endl;
+	std::cout << "PPM   ĳ ڴ ε : " << (bPPM ? "O" : "X") << std::endl;
+}
+
+void ShowTransformInfo(const UStaticMesh& InUStaticMesh)
+{
+	using Clock = chrono::steady_clock;
+
+	const vector<Vertex>& Vertices = InUStaticMesh.Vertices;
+	const size_t NumVertices = Vertices.size();
+
+	std::cout << "===  Ʈ ȯ ( " << NumVertices << ", Ŀ " << FThreadPool::Get().Num() << ", " << (SIMD_SSE2 ? "SSE2" : "Į") << ") ===" << std::endl;
+
+	// ȸ + ະ ũ + ̵. Mirror x ſ
+	const float Angle = 0.7f;
+	FMatrix World;
+	World.M[0][0] = cosf(Angle) * 2.0f;	World.M[0][1] = -sinf(Angle) * 0.5f;	World.M[0][3] = 10.0f;
+	World.M[1][0] = sinf(Angle) * 2.0f;	World.M[1][1] = cosf(Angle) * 0.5f;	World.M[1][3] = -3.0f;
+	World.M[2][2] = 1.5f;												World.M[2][3] = 7.0f;
+
+	FMatrix Mirror = World;
+	Mirror.M[0][0] = -Mirror.M[0][0];
+	Mirror.M[0][1] = -Mirror.M[0][1];
+	Mirror.M[0][3] = -Mirror.M[0][3];
+
+	UStaticMesh Baked, Mirrored;
+	vector<Vertex> Copy(NumVertices);
+	const int NumRuns = 10;
+
+	auto Measure = [&](auto&& Body)
+	{
+		Body();
+		auto Start = Clock::now();
+
+		for (int Run = 0; Run < NumRuns; Run++)
+		{
+			Body();
+		}
+
+		return chrono::duration<double>(Clock::now() - Start).count() / NumRuns;
+	};
+
+	const double CopySeconds = Measure([&]() { memcpy(Copy.data(), Vertices.data(), NumVertices * sizeof(Vertex)); });
+	const double TransformSeconds = Measure([&]() { TransformVertices(World, Vertices.data(), Copy.data(), NumVertices); });
+	const double ScalarSeconds = Measure([&]()
+	{
+		const FMatrix Normal = GetNormalMatrix(World);
+
+		for (size_t i = 0; i < NumVertices; i++)
+		{
+			Copy[i].Location = World * Vertices[i].Location;
+			Copy[i].Normal = NormalizeOr(Normal.TransformDirection(Vertices[i].Normal), FVector());
+		}
+	});
+
+	BakeWorldSpace(InUStaticMesh, World, Baked);
+	BakeWorldSpace(InUStaticMesh, Mirror, Mirrored);
+
+	// Į ذ , ٿ尡   ϴ
+	const FMatrix Normal = GetNormalMatrix(World);
+	float MaxError = 0.0f;
+	bool bUVKept = true;
+	bool bInBounds = true;
+
+	for (size_t i = 0; i < NumVertices; i++)
+	{
+		const FVector P = World * Vertices[i].Location;
+		const FVector N = NormalizeOr(Normal.TransformDirection(Vertices[i].Normal), FVector());
+		const Vertex& B = Baked.Vertices[i];
+
+		MaxError = max(MaxError, max(fabsf(P.x - B.Location.x), max(fabsf(P.y - B.Location.y), fabsf(P.z - B.Location.z))) / max(1.0f, Baked.BoundingSphere.Radius));
+		MaxError = max(MaxError, max(fabsf(N.x - B.Normal.x), max(fabsf(N.y - B.Normal.y), fabsf(N.z - B.Normal.z))));
+		bUVKept = bUVKept && B.TexCoord.u == Vertices[i].TexCoord.u && B.TexCoord.v == Vertices[i].TexCoord.v;
+
+		for (int Axis = 0; Axis < 3; Axis++)
+		{
+			bInBounds = bInBounds && GetAxis(B.Location, Axis) >= GetAxis(Baked.Bounds.Min, Axis) && GetAxis(B.Location, Axis) <= GetAxis(Baked.Bounds.Max, Axis);
+		}
+	}
+
+	//  ( )      ﰢ  ſ Ŀ ƾ 
+	//   ƴ϶  ķ  Baked (ະ ũⰡ ٸ  ȭ ﰢ  ȣ ޶  )
+	//     ﰢ ȣ  ¿ǹǷ  
+	// (apple_midó   vn ݴ  0 , ⸦    η ٲǷ 񱳴 ȿ)
+	auto CountFrontFacing = [](const UStaticMesh& Mesh)
+	{
+		size_t Count = 0;
+
+		for (size_t t = 0; t + 2 < Mesh.Indices.size(); t += 3)
+		{
+			const Vertex& A = Mesh.Vertices[Mesh.Indices[t]];
+			const Vertex& B = Mesh.Vertices[Mesh.Indices[t + 1]];
+			const Vertex& C = Mesh.Vertices[Mesh.Indices[t + 2]];
+			const FVector E1(B.Location.x - A.Location.x, B.Location.y - A.Location.y, B.Location.z - A.Location.z);
+			const FVector E2(C.Location.x - A.Location.x, C.Location.y - A.Location.y, C.Location.z - A.Location.z);
+
+			const FVector FaceNormal = Cross(E1, E2);
+
+			if (Dot(FaceNormal, FaceNormal) <= 1e-12f * Dot(E1, E1) * Dot(E2, E2))
+			{
+				continue;
+			}
+
+			Count += Dot(FaceNormal, A.Normal) > 0.0f ? 1 : 0;
+		}
+
+		return Count;
+	};
+
+	const size_t FrontFacing = CountFrontFacing(Baked);
+
+	// ະ ũⰡ ٸ ķ  źƮ      (   )
+	// ܺο  źƮó  Ȯ  ƴ Էµ ٽ  ϹǷ  źƮ   ￩ 
+	UStaticMesh WithTangents = InUStaticMesh;
+	UStaticMesh BakedTangents;
+
+	if (WithTangents.Tangents.empty())
+	{
+		GenerateTangents(WithTangents);
+	}
+
+	for (size_t i = 0; i < WithTangents.Tangents.size(); i++)
+	{
+		FVector& T = WithTangents.Tangents[i].Direction;
+		const FVector& N = WithTangents.Vertices[i].Normal;
+
+		T = NormalizeOr(FVector(T.x + N.x * 0.2f, T.y + N.y * 0.2f, T.z + N.z * 0.2f), T);
+	}
+
+	BakeWorldSpace(WithTangents, World, BakedTangents);
+
+	bool bOrthonormalTangents = BakedTangents.Tangents.size() == BakedTangents.Vertices.size();
+
+	for (size_t i = 0; i < BakedTangents.Tangents.size() && bOrthonormalTangents; i++)
+	{
+		const FVector& N = BakedTangents.Vertices[i].Normal;
+		const FVector& T = BakedTangents.Tangents[i].Direction;
+
+		if (Dot(N, N) > 0.5f)
+		{
+			bOrthonormalTangents = fabsf(Dot(T, T) - 1.0f) < 1e-4f && fabsf(Dot(T, N)) < 1e-3f;
+		}
+	}
+	const double Bytes = 2.0 * NumVertices * sizeof(Vertex);
+
+	std::cout << "memcpy        : " << CopySeconds * 1000.0 << " ms (" << Bytes / CopySeconds / 1e9 << " GB/s)" << std::endl;
+	std::cout << "TransformVertices : " << TransformSeconds * 1000.0 << " ms (" << Bytes / TransformSeconds / 1e9 << " GB/s, memcpy " << CopySeconds / TransformSeconds * 100.0 << "%)" << std::endl;
+	std::cout << " ϳ   : " << ScalarSeconds * 1000.0 << " ms" << std::endl;
+
+	// memcpy 80% ̸̻ ޸ 뿪  .  ġ ڸ  ʰ ̴޷ ǥ
+	const double BandwidthRatio = CopySeconds / TransformSeconds;
+	std::cout << "뿪 ǥ (memcpy 80% ̻) : " << (BandwidthRatio >= 0.8 ? "" : "̴ (SSE2  ھ ȯ/ȭ  )") << std::endl;
+	std::cout << "Į  ִ  : " << MaxError << std::endl;
+	std::cout << " ġ / UV  / ٿ : " << (MaxError < 1e-4f && bUVKept && bInBounds ? "O" : "X") << std::endl;
+	std::cout << "źƮ  ( Է) : " << (bOrthonormalTangents ? "O" : "X") << std::endl;
+	std::cout << "ſ    : " << (!Baked.Indices.empty() && CountFrontFacing(Mirrored) == FrontFacing ? "O" : "X") << std::endl;
+}
@@ -0,0 +1,495 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "Structs.h"
+#include "FMatrix.h"
+#include "ThreadPool.h"
+#include "SimdFloat4.h"
+#include "MeshNormals.h"
+
+// ȸ  (x, y, z = ͺ, w = Į). ȸ    1
+//  İ  : (A * B).RotateVector(v) = A.RotateVector(B.RotateVector(v))
+struct FQuat
+{
+	float x = 0.0f;
+	float y = 0.0f;
+	float z = 0.0f;
+	float w = 1.0f;
+
+	constexpr FQuat() = default;
+	constexpr FQuat(float InX, float InY, float InZ, float InW) : x(InX), y(InY), z(InZ), w(InW) {}
+
+	static constexpr FQuat Identity()
+	{
+		return FQuat();
+	}
+
+	// Axis  1.   ⿡   ݽð (FMatrix::RotationX/Y/Z  )
+	static constexpr FQuat FromAxisAngle(const FVector& Axis, float Radians)
+	{
+		float s = 0.0f, c = 0.0f;
+		ConstSinCos(Radians * 0.5f, s, c);
+
+		return FQuat(Axis.x * s, Axis.y * s, Axis.z * s, c);
+	}
+
+	// ũ  ȸ ( 3x3). 밢   ū 밢    (е)
+	static constexpr FQuat FromRotationMatrix(const FMatrix& Matrix)
+	{
+		const float (&M)[4][4] = Matrix.M;
+		const float Trace = M[0][0] + M[1][1] + M[2][2];
+
+		if (Trace > 0.0f)
+		{
+			const float s = 0.5f / ConstSqrt(Trace + 1.0f);
+			return FQuat((M[2][1] - M[1][2]) * s, (M[0][2] - M[2][0]) * s, (M[1][0] - M[0][1]) * s, 0.25f / s);
+		}
+
+		if (M[0][0] > M[1][1] && M[0][0] > M[2][2])
+		{
+			const float s = 2.0f * ConstSqrt(1.0f + M[0][0] - M[1][1] - M[2][2]);
+			return FQuat(0.25f * s, (M[0][1] + M[1][0]) / s, (M[0][2] + M[2][0]) / s, (M[2][1] - M[1][2]) / s);
+		}
+
+		if (M[1][1] > M[2][2])
+		{
+			const float s = 2.0f * ConstSqrt(1.0f + M[1][1] - M[0][0] - M[2][2]);
+			return FQuat((M[0][1] + M[1][0]) / s, 0.25f * s, (M[1][2] + M[2][1]) / s, (M[0][2] - M[2][0]) / s);
+		}
+
+		const float s = 2.0f * ConstSqrt(1.0f + M[2][2] - M[0][0] - M[1][1]);
+		return FQuat((M[0][2] + M[2][0]) / s, (M[1][2] + M[2][1]) / s, 0.25f * s, (M[1][0] - M[0][1]) / s);
+	}
+
+	constexpr FQuat operator*(const FQuat& B) const
+	{
+		return FQuat
+		(
+			w * B.x + x * B.w + y * B.z - z * B.y,
+			w * B.y - x * B.z + y * B.w + z * B.x,
+			w * B.z + x * B.y - y * B.x + z * B.w,
+			w * B.w - x * B.x - y * B.y - z * B.z
+		);
+	}
+
+	//  1   (ӷ)
+	constexpr FQuat Inverse() const
+	{
+		return FQuat(-x, -y, -z, w);
+	}
+
+	// v' = v + w * t + q x t, t = 2 * (q x v) (ķ ٲ ʰ   )
+	constexpr FVector RotateVector(const FVector& V) const
+	{
+		const FVector q(x, y, z);
+		const FVector c = Cross(q, V);
+		const FVector t(c.x * 2.0f, c.y * 2.0f, c.z * 2.0f);
+		const FVector u = Cross(q, t);
+
+		return FVector(V.x + w * t.x + u.x, V.y + w * t.y + u.y, V.z + w * t.z + u.z);
+	}
+
+	// ̰ 0̸  
+	constexpr FQuat GetNormalized() const
+	{
+		const float LengthSquared = x * x + y * y + z * z + w * w;
+
+		if (LengthSquared < 1e-30f)
+		{
+			return Identity();
+		}
+
+		const float InvLength = 1.0f / ConstSqrt(LengthSquared);
+
+		return FQuat(x * InvLength, y * InvLength, z * InvLength, w * InvLength);
+	}
+
+	constexpr FMatrix ToMatrix() const
+	{
+		FMatrix Result;
+
+		Result.M[0][0] = 1.0f - 2.0f * (y * y + z * z);	Result.M[0][1] = 2.0f * (x * y - w * z);		Result.M[0][2] = 2.0f * (x * z + w * y);
+		Result.M[1][0] = 2.0f * (x * y + w * z);		Result.M[1][1] = 1.0f - 2.0f * (x * x + z * z);	Result.M[1][2] = 2.0f * (y * z - w * x);
+		Result.M[2][0] = 2.0f * (x * z - w * y);		Result.M[2][1] = 2.0f * (y * z + w * x);		Result.M[2][2] = 1.0f - 2.0f * (x * x + y * y);
+
+		return Result;
+	}
+};
+
+constexpr float Dot(const FQuat& A, const FQuat& B)
+{
+	return A.x * B.x + A.y * B.y + A.z * B.z + A.w * B.w;
+}
+
+//    ȭ. ӵ   ΰ,   ȸ(ִϸ̼ Ű  ) Slerp  
+// q -q  ȸ̹Ƿ Dot  B  ª  
+inline FQuat Nlerp(const FQuat& A, const FQuat& B, float Alpha)
+{
+	const float Sign = Dot(A, B) < 0.0f ? -1.0f : 1.0f;
+	const float WA = 1.0f - Alpha;
+	const float WB = Alpha * Sign;
+
+	return FQuat(A.x * WA + B.x * WB, A.y * WA + B.y * WB, A.z * WA + B.z * WB, A.w * WA + B.w * WB).GetNormalized();
+}
+
+//    (ӵ ).  ȸ   sin() Ⱑ ҾϹǷ Nlerp
+inline FQuat Slerp(const FQuat& A, const FQuat& B, float Alpha)
+{
+	float CosAngle = Dot(A, B);
+	float Sign = 1.0f;
+
+	if (CosAngle < 0.0f)
+	{
+		CosAngle = -CosAngle;
+		Sign = -1.0f;
+	}
+
+	if (CosAngle > 0.9995f)
+	{
+		return Nlerp(A, B, Alpha);
+	}
+
+	const float Angle = acosf(CosAngle);
+	const float InvSin = 1.0f / sinf(Angle);
+	const float WA = sinf((1.0f - Alpha) * Angle) * InvSin;
+	const float WB = sinf(Alpha * Angle) * InvSin * Sign;
+
+	return FQuat(A.x * WA + B.x * WB, A.y * WA + B.y * WB, A.z * WA + B.z * WB, A.w * WA + B.w * WB);
+}
+
+// ũ -> ȸ -> ̵  ȯ (ķδ T * R * S). 40Ʈ (FMatrix 64Ʈ)
+// ռ/ȯ θ ũⰡ յϸ Ȯϰ, ະ ٸ  ο ޸ (shear) 
+struct FTransform
+{
+	FQuat Rotation;
+	FVector Translation;
+	FVector Scale3D = FVector(1.0f, 1.0f, 1.0f);
+
+	constexpr FTransform() = default;
+
+	constexpr FTransform(const FQuat& InRotation, const FVector& InTranslation, const FVector& InScale3D = FVector(1.0f, 1.0f, 1.0f))
+		: Rotation(InRotation)
+		, Translation(InTranslation)
+		, Scale3D(InScale3D)
+	{
+	}
+
+	static constexpr FTransform Identity()
+	{
+		return FTransform();
+	}
+
+	//     ũ( ), ȸ, ̵ . Ľ  x ũ⸦ 
+	static constexpr FTransform FromMatrix(const FMatrix& Matrix)
+	{
+		const float (&M)[4][4] = Matrix.M;
+		float Scale[3] = {};
+		FMatrix Rotation;
+
+		for (int c = 0; c < 3; c++)
+		{
+			Scale[c] = ConstSqrt(M[0][c] * M[0][c] + M[1][c] * M[1][c] + M[2][c] * M[2][c]);
+		}
+
+		if (Matrix.Determinant() < 0.0f)
+		{
+			Scale[0] = -Scale[0];
+		}
+
+		for (int c = 0; c < 3; c++)
+		{
+			const float InvScale = Scale[c] != 0.0f ? 1.0f / Scale[c] : 0.0f;
+
+			for (int r = 0; r < 3; r++)
+			{
+				Rotation.M[r][c] = M[r][c] * InvScale;
+			}
+		}
+
+		return FTransform(FQuat::FromRotationMatrix(Rotation), FVector(M[0][3], M[1][3], M[2][3]), FVector(Scale[0], Scale[1], Scale[2]));
+	}
+
+	constexpr FVector TransformPosition(const FVector& P) const
+	{
+		const FVector R = Rotation.RotateVector(FVector(P.x * Scale3D.x, P.y * Scale3D.y, P.z * Scale3D.z));
+
+		return FVector(R.x + Translation.x, R.y + Translation.y, R.z + Translation.z);
+	}
+
+	constexpr FVector TransformDirection(const FVector& D) const
+	{
+		return Rotation.RotateVector(FVector(D.x * Scale3D.x, D.y * Scale3D.y, D.z * Scale3D.z));
+	}
+
+	// this θ, Child θ    ڽ  ȯ. ķδ ToMatrix() * Child.ToMatrix()  
+	constexpr FTransform operator*(const FTransform& Child) const
+	{
+		return FTransform
+		(
+			Rotation * Child.Rotation,
+			TransformPosition(Child.Translation),
+			FVector(Scale3D.x * Child.Scale3D.x, Scale3D.y * Child.Scale3D.y, Scale3D.z * Child.Scale3D.z)
+		);
+	}
+
+	// ũⰡ 0   0
+	constexpr FTransform Inverse() const
+	{
+		const FQuat InvRotation = Rotation.Inverse();
+		const FVector InvScale(Scale3D.x != 0.0f ? 1.0f / Scale3D.x : 0.0f, Scale3D.y != 0.0f ? 1.0f / Scale3D.y : 0.0f, Scale3D.z != 0.0f ? 1.0f / Scale3D.z : 0.0f);
+		const FVector T = InvRotation.RotateVector(FVector(-Translation.x, -Translation.y, -Translation.z));
+
+		return FTransform(InvRotation, FVector(T.x * InvScale.x, T.y * InvScale.y, T.z * InvScale.z), InvScale);
+	}
+
+	//    ʿ  θ: ȸ   ũ⸦ ϰ ̵  
+	constexpr FMatrix ToMatrix() const
+	{
+		FMatrix Result = Rotation.ToMatrix();
+		const float Scale[3] = { Scale3D.x, Scale3D.y, Scale3D.z };
+
+		for (int r = 0; r < 3; r++)
+		{
+			for (int c = 0; c < 3; c++)
+			{
+				Result.M[r][c] *= Scale[c];
+			}
+		}
+
+		Result.M[0][3] = Translation.x;
+		Result.M[1][3] = Translation.y;
+		Result.M[2][3] = Translation.z;
+
+		return Result;
+	}
+};
+
+// ȸ Nlerp (bSlerp Slerp), ̵/ũ 
+inline FTransform BlendTransforms(const FTransform& A, const FTransform& B, float Alpha, bool bSlerp = false)
+{
+	auto Lerp = [Alpha](const FVector& From, const FVector& To)
+	{
+		return FVector(From.x + (To.x - From.x) * Alpha, From.y + (To.y - From.y) * Alpha, From.z + (To.z - From.z) * Alpha);
+	};
+
+	return FTransform(bSlerp ? Slerp(A.Rotation, B.Rotation, Alpha) : Nlerp(A.Rotation, B.Rotation, Alpha), Lerp(A.Translation, B.Translation), Lerp(A.Scale3D, B.Scale3D));
+}
+
+//  N ȯ к 迭 ( 4 FFloat4 ϳ а )
+struct FTransformSoA
+{
+	vector<float> QX, QY, QZ, QW;
+	vector<float> TX, TY, TZ;
+	vector<float> SX, SY, SZ;
+
+	void Resize(size_t NumNodes)
+	{
+		for (vector<float>* Array : { &QX, &QY, &QZ, &TX, &TY, &TZ })
+		{
+			Array->resize(NumNodes, 0.0f);
+		}
+
+		for (vector<float>* Array : { &QW, &SX, &SY, &SZ })
+		{
+			Array->resize(NumNodes, 1.0f);
+		}
+	}
+
+	size_t Num() const
+	{
+		return QX.size();
+	}
+
+	void Set(size_t i, const FTransform& Transform)
+	{
+		QX[i] = Transform.Rotation.x; QY[i] = Transform.Rotation.y; QZ[i] = Transform.Rotation.z; QW[i] = Transform.Rotation.w;
+		TX[i] = Transform.Translation.x; TY[i] = Transform.Translation.y; TZ[i] = Transform.Translation.z;
+		SX[i] = Transform.Scale3D.x; SY[i] = Transform.Scale3D.y; SZ[i] = Transform.Scale3D.z;
+	}
+
+	FTransform Get(size_t i) const
+	{
+		return FTransform(FQuat(QX[i], QY[i], QZ[i], QW[i]), FVector(TX[i], TY[i], TZ[i]), FVector(SX[i], SY[i], SZ[i]));
+	}
+};
+
+//    (T = FFloat4  4, float 1)
+template<typename T>
+struct TTransformLanes
+{
+	T QX, QY, QZ, QW;
+	T TX, TY, TZ;
+	T SX, SY, SZ;
+
+	void Load(const FTransformSoA& Source, size_t i)
+	{
+		QX = LoadLanes<T>(&Source.QX[i]); QY = LoadLanes<T>(&Source.QY[i]); QZ = LoadLanes<T>(&Source.QZ[i]); QW = LoadLanes<T>(&Source.QW[i]);
+		TX = LoadLanes<T>(&Source.TX[i]); TY = LoadLanes<T>(&Source.TY[i]); TZ = LoadLanes<T>(&Source.TZ[i]);
+		SX = LoadLanes<T>(&Source.SX[i]); SY = LoadLanes<T>(&Source.SY[i]); SZ = LoadLanes<T>(&Source.SZ[i]);
+	}
+
+	// θ Indices[l] 带  (θ ȯ)
+	void Gather(const FTransformSoA& Source, const int* Indices)
+	{
+		QX = GatherLanes<T>(Source.QX.data(), Indices); QY = GatherLanes<T>(Source.QY.data(), Indices); QZ = GatherLanes<T>(Source.QZ.data(), Indices); QW = GatherLanes<T>(Source.QW.data(), Indices);
+		TX = GatherLanes<T>(Source.TX.data(), Indices); TY = GatherLanes<T>(Source.TY.data(), Indices); TZ = GatherLanes<T>(Source.TZ.data(), Indices);
+		SX = GatherLanes<T>(Source.SX.data(), Indices); SY = GatherLanes<T>(Source.SY.data(), Indices); SZ = GatherLanes<T>(Source.SZ.data(), Indices);
+	}
+
+	void Store(FTransformSoA& Target, size_t i) const
+	{
+		StoreLanes(&Target.QX[i], QX); StoreLanes(&Target.QY[i], QY); StoreLanes(&Target.QZ[i], QZ); StoreLanes(&Target.QW[i], QW);
+		StoreLanes(&Target.TX[i], TX); StoreLanes(&Target.TY[i], TY); StoreLanes(&Target.TZ[i], TZ);
+		StoreLanes(&Target.SX[i], SX); StoreLanes(&Target.SY[i], SY); StoreLanes(&Target.SZ[i], SZ);
+	}
+};
+
+// FTransform::operator* κ (Parent * Child)
+template<typename T>
+inline void ComposeTransformLanes(const TTransformLanes<T>& P, const TTransformLanes<T>& C, TTransformLanes<T>& Out)
+{
+	// ȸ:  
+	Out.QX = P.QW * C.QX + P.QX * C.QW + P.QY * C.QZ - P.QZ * C.QY;
+	Out.QY = P.QW * C.QY - P.QX * C.QZ + P.QY * C.QW + P.QZ * C.QX;
+	Out.QZ = P.QW * C.QZ + P.QX * C.QY - P.QY * C.QX + P.QZ * C.QW;
+	Out.QW = P.QW * C.QW - P.QX * C.QX - P.QY * C.QY - P.QZ * C.QZ;
+
+	// ̵: θ ũ -> θ ȸ (RotateVector    ) -> θ ̵
+	const T Two = SplatLanes<T>(2.0f);
+	const T Vx = C.TX * P.SX, Vy = C.TY * P.SY, Vz = C.TZ * P.SZ;
+	const T tx = Two * (P.QY * Vz - P.QZ * Vy);
+	const T ty = Two * (P.QZ * Vx - P.QX * Vz);
+	const T tz = Two * (P.QX * Vy - P.QY * Vx);
+
+	Out.TX = Vx + P.QW * tx + (P.QY * tz - P.QZ * ty) + P.TX;
+	Out.TY = Vy + P.QW * ty + (P.QZ * tx - P.QX * tz) + P.TY;
+	Out.TZ = Vz + P.QW * tz + (P.QX * ty - P.QY * tx) + P.TZ;
+
+	Out.SX = P.SX * C.SX;
+	Out.SY = P.SY * C.SY;
+	Out.SZ = P.SZ * C.SZ;
+}
+
+// θ-ڽ    ->  ȯ 
+//   (Ʈ,  1,  2, ...)  ־ .   峢  ̹Ƿ
+// ̸  4 SIMD ռϰ 尡   Ǯ ó (θ θ Ƽ )
+//   GetWorldMatrix ʿ 常 
+class FTransformHierarchy
+{
+public:
+	// Parents[i] = i  θ (Ʈ -1).   ƴϸ false ( ״)
+	bool SetParents(vector<int> InParents)
+	{
+		vector<size_t> Offsets;
+		vector<int> Depths(InParents.size());
+
+		for (size_t i = 0; i < InParents.size(); i++)
+		{
+			const int Parent = InParents[i];
+
+			if (Parent >= static_cast<int>(i))
+			{
+				return false;
+			}
+
+			Depths[i] = Parent < 0 ? 0 : Depths[Parent] + 1;
+
+			// θ տ Ƿ ̴   ִ 1 þ
+			if (i > 0 && Depths[i] < Depths[i - 1])
+			{
+				return false;
+			}
+
+			if (i == 0 || Depths[i] != Depths[i - 1])
+			{
+				Offsets.push_back(i);
+			}
+		}
+
+		Offsets.push_back(InParents.size());
+
+		Parents = move(InParents);
+		LevelOffsets = move(Offsets);
+		Local.Resize(Parents.size());
+		World.Resize(Parents.size());
+
+		return true;
+	}
+
+	size_t Num() const
+	{
+		return Parents.size();
+	}
+
+	size_t NumLevels() const
+	{
+		return LevelOffsets.empty() ? 0 : LevelOffsets.size() - 1;
+	}
+
+	void SetLocal(size_t i, const FTransform& Transform)
+	{
+		Local.Set(i, Transform);
+	}
+
+	FTransform GetLocal(size_t i) const
+	{
+		return Local.Get(i);
+	}
+
+	FTransform GetWorld(size_t i) const
+	{
+		return World.Get(i);
+	}
+
+	FMatrix GetWorldMatrix(size_t i) const
+	{
+		return World.Get(i).ToMatrix();
+	}
+
+	const FTransformSoA& GetWorldArrays() const
+	{
+		return World;
+	}
+
+	void UpdateWorld(FThreadPool& Pool = FThreadPool::Get())
+	{
+		for (size_t Level = 0; Level < NumLevels(); Level++)
+		{
+			const size_t LevelBegin = LevelOffsets[Level];
+			const size_t LevelCount = LevelOffsets[Level + 1] - LevelBegin;
+
+			ParallelForRanges(Pool, LevelCount, MinElementsPerTask, [&](size_t Begin, size_t End)
+			{
+				ForEachLanes(LevelBegin + Begin, LevelBegin + End, [&](size_t i, auto Lanes)
+				{
+					using T = decltype(Lanes);
+
+					TTransformLanes<T> Child;
+					Child.Load(Local, i);
+
+					if (Level == 0)
+					{
+						Child.Store(World, i);
+						return;
+					}
+
+					TTransformLanes<T> Parent, Result;
+					Parent.Gather(World, &Parents[i]);
+
+					ComposeTransformLanes(Parent, Child, Result);
+					Result.Store(World, i);
+				});
+			});
+		}
+	}
+
+private:
+	vector<int> Parents;
+	vector<size_t> LevelOffsets;	//  d  = [LevelOffsets[d], LevelOffsets[d + 1])
+	FTransformSoA Local;
+	FTransformSoA World;
+};
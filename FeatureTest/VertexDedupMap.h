@@ -0,0 +1,127 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+// (ġ, UV, ) ε 3 ״ Ű   巹 ؽ ̺ ( Ž)
+// ڿ Ű  Ƿ   Ҵ 
+class FVertexDedupMap
+{
+public:
+	explicit FVertexDedupMap(size_t ExpectedKeys = 0)
+	{
+		Reserve(ExpectedKeys);
+	}
+
+	//  0.5 ϰ ǵ 2 ŵ ũ ̸ Ҵ
+	void Reserve(size_t ExpectedKeys)
+	{
+		size_t Capacity = 16;
+
+		while (Capacity < ExpectedKeys * 2)
+		{
+			Capacity <<= 1;
+		}
+
+		if (Capacity > Slots.size())
+		{
+			Rehash(Capacity);
+		}
+	}
+
+	// Ű ̹   ,  NewValue ְ ״ ȯ
+	int32_t FindOrAdd(int32_t P, int32_t T, int32_t N, int32_t NewValue, bool& bOutAdded)
+	{
+		if ((Count + 1) * 4 > Slots.size() * 3)
+		{
+			Rehash(Slots.size() * 2);
+		}
+
+		size_t i = Hash(P, T, N) & Mask;
+
+		while (true)
+		{
+			FSlot& Slot = Slots[i];
+
+			if (Slot.Value < 0)
+			{
+				Slot = { P, T, N, NewValue };
+				Count++;
+				bOutAdded = true;
+				return NewValue;
+			}
+
+			if (Slot.P == P && Slot.T == T && Slot.N == N)
+			{
+				bOutAdded = false;
+				return Slot.Value;
+			}
+
+			i = (i + 1) & Mask;
+		}
+	}
+
+	size_t Num() const
+	{
+		return Count;
+	}
+
+	size_t GetAllocatedSize() const
+	{
+		return Slots.capacity() * sizeof(FSlot);
+	}
+
+	void Clear()
+	{
+		Slots.assign(Slots.size(), FSlot{ 0, 0, 0, -1 });
+		Count = 0;
+	}
+
+private:
+	// Value < 0 ̸  
+	struct FSlot
+	{
+		int32_t P;
+		int32_t T;
+		int32_t N;
+		int32_t Value;
+	};
+
+	static size_t Hash(int32_t P, int32_t T, int32_t N)
+	{
+		uint64_t h = static_cast<uint32_t>(P) * 0x9E3779B97F4A7C15ull;
+		h ^= static_cast<uint32_t>(T) * 0xC2B2AE3D27D4EB4Full;
+		h ^= static_cast<uint32_t>(N) * 0x165667B19E3779F9ull;
+		h ^= h >> 32;
+
+		return static_cast<size_t>(h);
+	}
+
+	void Rehash(size_t NewCapacity)
+	{
+		std::vector<FSlot> OldSlots(NewCapacity, FSlot{ 0, 0, 0, -1 });
+		OldSlots.swap(Slots);
+		Mask = NewCapacity - 1;
+
+		for (const FSlot& Slot : OldSlots)
+		{
+			if (Slot.Value < 0)
+			{
+				continue;
+			}
+
+			size_t i = Hash(Slot.P, Slot.T, Slot.N) & Mask;
+
+			while (Slots[i].Value >= 0)
+			{
+				i = (i + 1) & Mask;
+			}
+
+			Slots[i] = Slot;
+		}
+	}
+
+	std::vector<FSlot> Slots;
+	size_t Mask = 0;
+	size_t Count = 0;
+};